@@ -0,0 +1,84 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <SFML/System.hpp>
+
+#include "circle_kernel.h"
+
+namespace {
+
+const std::size_t PAIR_COUNTS[] = {10000U, 100000U, 1000000U};
+const std::size_t TESTS_PER_SIZE = 20000000U;
+const float ARENA_SIZE = 200.0F;
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+void run(std::size_t count, std::mt19937 &generator) {
+  std::uniform_real_distribution<float> coordinate{0.0F, ARENA_SIZE};
+  std::uniform_real_distribution<float> radius{2.0F, 50.0F};
+  ag::CirclePairs pairs;
+  for (std::size_t i = 0U; i < count; i++) {
+    pairs.push_back(sf::Vector2f{coordinate(generator), coordinate(generator)},
+                    radius(generator),
+                    sf::Vector2f{coordinate(generator), coordinate(generator)},
+                    radius(generator));
+  }
+  std::size_t rounds = TESTS_PER_SIZE / count;
+  std::vector<unsigned char> scalar_hits(count);
+  std::vector<std::uint32_t> hit_mask;
+
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0U; round < rounds; round++) {
+    for (std::size_t i = 0U; i < count; i++) {
+      scalar_hits[i] = ag::circles_overlap(
+        pairs.first_x[i], pairs.first_y[i], pairs.first_radius[i],
+        pairs.second_x[i], pairs.second_y[i], pairs.second_radius[i]);
+    }
+  }
+  double scalar_time = seconds_since(start);
+
+  start = std::chrono::steady_clock::now();
+  for (std::size_t round = 0U; round < rounds; round++) {
+    ag::circle_circle_batch(pairs, hit_mask);
+  }
+  double batch_time = seconds_since(start);
+
+  std::size_t hits = 0U;
+  std::size_t mismatches = 0U;
+  for (std::size_t i = 0U; i < count; i++) {
+    bool hit = ag::batch_hit(hit_mask, i);
+    hits += hit ? 1U : 0U;
+    mismatches += hit != (scalar_hits[i] != 0U) ? 1U : 0U;
+  }
+  double tests = static_cast<double>(rounds) * count;
+  std::printf("%8zu pairs  scalar %12.0f pairs/s  batch %12.0f pairs/s  "
+              "%4.1f%% hits  %zu mismatches\n", count, tests / scalar_time,
+              tests / batch_time, 100.0 * hits / count, mismatches);
+}
+
+}
+
+// Times circle_circle_batch against the scalar circles_overlap loop on the
+// same random pairs and checks that both give the same answers.
+int main() {
+  std::mt19937 generator{1U};
+#if defined(__AVX__)
+  std::printf("batch path: AVX\n");
+#elif defined(__SSE__)
+  std::printf("batch path: SSE\n");
+#else
+  std::printf("batch path: scalar\n");
+#endif
+  for (std::size_t count : PAIR_COUNTS) {
+    run(count, generator);
+  }
+  return 0;
+}
@@ -0,0 +1,447 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "allocation_tracker.h"
+#include "asteroid.h"
+#include "broadphase.h"
+#include "bullet.h"
+#include "circle_kernel.h"
+#include "collision_manager.h"
+#include "entity_store.h"
+#include "game_object.h"
+#include "input.h"
+#include "polygon.h"
+#include "quadtree.h"
+#include "random.h"
+#include "saucer.h"
+#include "simulation.h"
+#include "spaceship.h"
+#include "world.h"
+
+namespace {
+
+const std::size_t ENTITY_COUNTS[] = {10U, 100U, 1000U, 10000U, 100000U};
+// Each benchmark repeats until it has run this long in total; cheap kernels
+// also repeat inside a timed run until it holds at least MIN_OPS operations,
+// so the clock's own cost stays out of the result.
+const double MIN_SECONDS = 0.25;
+const std::size_t MIN_OPS = 10000U;
+const sf::Vector2f WORLD_SIZE{1280.0F, 720.0F};
+// Broadphase benchmarks keep the crowding of this many entities in a world of
+// WORLD_SIZE, growing the arena with the count so that per-op costs compare.
+const float CROWD_SIZE = 1000.0F;
+const float ASTEROID_SIZES[] = {12.5F, 25.0F, 50.0F};
+const float DT = 1.0F / 60.0F;
+// Update runs are one second of play below this many asteroids and shorter
+// above it, since the world does not grow with them.
+const std::size_t TICK_BUDGET = 6000U;
+
+struct Result {
+  std::string name;
+  std::size_t entities;
+  const char *op;
+  std::uint64_t ops;
+  double seconds;
+  std::uint64_t allocations;
+  std::uint64_t bytes;
+};
+
+std::vector<Result> results;
+std::string name_filter;
+volatile std::size_t sink;
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+std::size_t repeats_for(std::size_t count) {
+  return std::max<std::size_t>(1U, MIN_OPS / count);
+}
+
+// Runs body, which performs ops operations, until MIN_SECONDS have passed.
+// Setup runs untimed before every run to put back whatever body used up.
+template <typename Setup, typename Body>
+void measure(const std::string &name, const char *op, std::size_t entities,
+             std::size_t ops, Setup setup, Body body) {
+  if (name.find(name_filter) == std::string::npos) {
+    return;
+  }
+  std::fprintf(stderr, "%s/%zu\n", name.c_str(), entities);
+  setup();
+  body();
+  Result result{name, entities, op, 0U, 0.0, 0U, 0U};
+  while (result.seconds < MIN_SECONDS) {
+    setup();
+    ag::AllocationTracker::begin_frame();
+    auto start = std::chrono::steady_clock::now();
+    body();
+    result.seconds += seconds_since(start);
+    ag::AllocationTracker::Counts counts =
+      ag::AllocationTracker::get_frame_counts();
+    result.allocations += counts.allocations;
+    result.bytes += counts.bytes;
+    result.ops += ops;
+  }
+  results.push_back(result);
+}
+
+template <typename Body>
+void measure(const std::string &name, const char *op, std::size_t entities,
+             std::size_t ops, Body body) {
+  measure(name, op, entities, ops, [] {}, body);
+}
+
+sf::Vector2f arena_size(std::size_t count) {
+  return WORLD_SIZE * std::max(1.0F, std::sqrt(count / CROWD_SIZE));
+}
+
+sf::Vector2f random_position(std::mt19937 &generator,
+                             sf::Vector2f area = WORLD_SIZE) {
+  std::uniform_real_distribution<float> x{0.0F, area.x};
+  std::uniform_real_distribution<float> y{0.0F, area.y};
+  return sf::Vector2f{x(generator), y(generator)};
+}
+
+float random_rotation(std::mt19937 &generator) {
+  return std::uniform_real_distribution<float>{0.0F, 360.0F}(generator);
+}
+
+float random_asteroid_size(std::mt19937 &generator) {
+  return ASTEROID_SIZES[generator() % 3U];
+}
+
+// The player's ship in the middle of the arena, then asteroids and the
+// player's bullets spread over it, one asteroid for every three bullets.
+void make_objects(ag::EntityStore &objects, std::size_t count,
+                  sf::Vector2f area, std::mt19937 &generator) {
+  ag::Spaceship player{objects, area / 2.0F};
+  for (std::size_t i = 1U; i < count; i++) {
+    if (i % 4U == 0U) {
+      float size = random_asteroid_size(generator);
+      sf::Vector2f position = random_position(generator, area);
+      ag::Asteroid::spawn(objects, size, position, random_rotation(generator));
+    } else {
+      float rotation = random_rotation(generator);
+      ag::Bullet::spawn(objects, ag::GameObject::PlayerType, rotation,
+                        sf::Vector2f{0.0F, 0.0F},
+                        random_position(generator, area), 2.0F);
+    }
+  }
+  objects.refresh_bounds();
+}
+
+void quadtree_benchmarks(std::size_t count, std::mt19937 &generator) {
+  using Tree = ag::QuadTree<10U, 5U>;
+  const sf::FloatRect area{sf::Vector2f{0.0F, 0.0F}, arena_size(count)};
+  const ag::Broadphase::Filter filter{~0U, ~0U};
+  ag::EntityStore objects;
+  make_objects(objects, count, arena_size(count), generator);
+  std::vector<sf::FloatRect> bounds = objects.bounds;
+  std::unique_ptr<Tree> tree;
+  measure("quadtree_insert", "insert", count, count,
+          [&] { tree.reset(new Tree{area}); },
+          [&] {
+            for (unsigned int i = 0U; i < count; i++) {
+              tree->insert(i, i, bounds[i], filter);
+            }
+          });
+  std::size_t repeats = repeats_for(count);
+  float step = 1.0F;
+  measure("quadtree_move", "insert", count, count * repeats, [&] {
+    for (std::size_t round = 0U; round < repeats; round++) {
+      step = -step;
+      for (unsigned int i = 0U; i < count; i++) {
+        bounds[i].left += step;
+        tree->insert(i, i, bounds[i], filter);
+      }
+    }
+  });
+  std::vector<ag::Broadphase::Candidate> candidates;
+  measure("quadtree_retrieve", "query", count, count * repeats, [&] {
+    for (std::size_t round = 0U; round < repeats; round++) {
+      for (unsigned int i = 0U; i < count; i++) {
+        candidates.clear();
+        tree->retrieve(i, bounds[i], filter, candidates);
+        sink = sink + candidates.size();
+      }
+    }
+  });
+}
+
+// Ship, saucer and circle placements packed closely enough that a good share
+// of them touch, as the collision manager's narrowphase sees them.
+void narrowphase_benchmarks(std::size_t count, std::mt19937 &generator) {
+  std::uniform_real_distribution<float> coordinate{0.0F, 120.0F};
+  std::vector<ag::Polygon<ag::Spaceship::POINT_COUNT>> ships;
+  std::vector<ag::Polygon<ag::Saucer::POINT_COUNT>> saucers;
+  ag::CirclePairs circles;
+  ag::EntityStore objects;
+  for (unsigned int i = 0U; i < count; i++) {
+    sf::Vector2f first{coordinate(generator), coordinate(generator)};
+    sf::Vector2f second{coordinate(generator), coordinate(generator)};
+    ag::Spaceship ship{objects, first};
+    unsigned int saucer = ag::Saucer::spawn(objects, second, 0.0F);
+    ag::Spaceship::refresh_vertices(objects, ship.get_index());
+    ag::Saucer::refresh_vertices(objects, saucer);
+    ships.push_back(ag::Spaceship::get_polygon(objects, ship.get_index()));
+    saucers.push_back(ag::Saucer::get_polygon(objects, saucer));
+    circles.push_back(first, random_asteroid_size(generator), second,
+                      random_asteroid_size(generator));
+  }
+  std::size_t repeats = repeats_for(count);
+  measure("ship_ship", "test", count, count * repeats, [&] {
+    for (std::size_t round = 0U; round < repeats; round++) {
+      for (std::size_t i = 0U; i < count; i++) {
+        sink = sink + ag::polygons_overlap(ships[i], saucers[i]);
+      }
+    }
+  });
+  measure("ship_circle", "test", count, count * repeats, [&] {
+    for (std::size_t round = 0U; round < repeats; round++) {
+      for (std::size_t i = 0U; i < count; i++) {
+        sink = sink + ag::polygon_circle_overlap(
+          ships[i], sf::Vector2f{circles.second_x[i], circles.second_y[i]},
+          circles.second_radius[i]);
+      }
+    }
+  });
+  measure("circle_circle", "test", count, count * repeats, [&] {
+    for (std::size_t round = 0U; round < repeats; round++) {
+      for (std::size_t i = 0U; i < count; i++) {
+        sink = sink + ag::circles_overlap(
+          circles.first_x[i], circles.first_y[i], circles.first_radius[i],
+          circles.second_x[i], circles.second_y[i], circles.second_radius[i]);
+      }
+    }
+  });
+  std::vector<std::uint32_t> hits;
+  measure("circle_circle_batch", "test", count, count * repeats, [&] {
+    for (std::size_t round = 0U; round < repeats; round++) {
+      ag::circle_circle_batch(circles, hits);
+      sink = sink + hits[0];
+    }
+  });
+}
+
+// Bullets fill the world so that every call scans them all but none block a
+// spawn; asteroids only fit a few dozen at a time.
+void spawn_benchmarks(std::size_t count, std::mt19937 &generator) {
+  ag::World world;
+  ag::Random random{1U};
+  ag::EntityStore objects;
+  ag::Spaceship player{objects, world.get_center()};
+  for (std::size_t i = 1U; i < count; i++) {
+    float rotation = random_rotation(generator);
+    ag::Bullet::spawn(objects, ag::GameObject::PlayerType, rotation,
+                      sf::Vector2f{0.0F, 0.0F}, random_position(generator),
+                      2.0F);
+  }
+  std::size_t repeats = std::max<std::size_t>(1U, 1000U / count);
+  measure("valid_asteroid_position", "call", count, repeats, [&] {
+    for (std::size_t round = 0U; round < repeats; round++) {
+      sink = sink + static_cast<std::size_t>(
+        world.valid_asteroid_position(objects, random).x);
+    }
+  });
+  measure("spawn_asteroid", "asteroid", count, repeats, [&] {
+    for (std::size_t round = 0U; round < repeats; round++) {
+      sf::Vector2f position = world.valid_asteroid_position(objects, random);
+      unsigned int asteroid = ag::Asteroid::spawn(
+        objects, 50.0F, position, static_cast<float>(random.next_below(360U)));
+      sink = sink + objects.handles[asteroid].value;
+      objects.truncate(count);
+    }
+  });
+}
+
+void collision_check_benchmarks(std::size_t count, std::mt19937 &generator) {
+  const char *NAMES[] = {"quadtree", "loose_quadtree", "grid",
+                         "sweep_and_prune"};
+  ag::EntityStore objects;
+  make_objects(objects, count, arena_size(count), generator);
+  ag::CollisionManager collision_manager{arena_size(count)};
+  for (int type = 0; type < ag::CollisionManager::BroadphaseCount; type++) {
+    collision_manager.set_broadphase(
+      static_cast<ag::CollisionManager::BroadphaseType>(type));
+    measure(std::string{"collision_check/"} + NAMES[type], "check", count, 1U,
+            [&] {
+              sink = sink + collision_manager.collision_check(objects).size();
+            });
+  }
+}
+
+// Asteroids, bullets and saucers crowded along the edges and corners of the
+// world, where most pairs meet across a seam, plus a bullet and an asteroid
+// that only touch across the left and right edges, and an asteroid over the
+// left edge and a saucer over the bottom edge that only touch across the
+// corner. Every broadphase must report the same contacts, both of those
+// pairs among them; returns false and says why otherwise.
+bool check_seam_contacts() {
+  const char *NAMES[] = {"quadtree", "loose_quadtree", "grid",
+                         "sweep_and_prune"};
+  std::mt19937 generator{2U};
+  std::uniform_real_distribution<float> edge{-40.0F, 40.0F};
+  ag::EntityStore objects;
+  ag::Asteroid::spawn(objects, ASTEROID_SIZES[0],
+                      sf::Vector2f{10.0F, 300.0F}, 0.0F);
+  ag::Bullet::spawn(objects, ag::GameObject::PlayerType, 90.0F,
+                    sf::Vector2f{0.0F, 0.0F},
+                    sf::Vector2f{WORLD_SIZE.x - 2.0F, 298.0F}, 1.0F);
+  ag::Asteroid::spawn(objects, ASTEROID_SIZES[2], sf::Vector2f{3.0F, 78.0F},
+                      0.0F);
+  ag::Saucer::spawn(objects, sf::Vector2f{WORLD_SIZE.x - 23.0F,
+                                          WORLD_SIZE.y - 4.0F}, 90.0F);
+  const std::pair<unsigned int, unsigned int> SEAM_PAIRS[] = {
+    std::make_pair(0U, 1U), std::make_pair(2U, 3U)};
+  for (std::size_t i = 0U; i < 400U; i++) {
+    sf::Vector2f position = random_position(generator);
+    switch (i % 3U) {
+    case 0U:
+      position.x = edge(generator);
+      break;
+    case 1U:
+      position.y = WORLD_SIZE.y + edge(generator);
+      break;
+    default:
+      position = sf::Vector2f{WORLD_SIZE.x + edge(generator),
+                              edge(generator)};
+      break;
+    }
+    if (i % 25U == 0U) {
+      ag::Saucer::spawn(objects, position, random_rotation(generator));
+    } else if (i % 4U == 0U) {
+      ag::Asteroid::spawn(objects, random_asteroid_size(generator), position,
+                          random_rotation(generator));
+    } else {
+      ag::Bullet::spawn(objects, ag::GameObject::PlayerType,
+                        random_rotation(generator), sf::Vector2f{0.0F, 0.0F},
+                        position, 1.0F);
+    }
+  }
+  objects.refresh_bounds();
+  ag::CollisionManager collision_manager{WORLD_SIZE};
+  std::vector<std::pair<unsigned int, unsigned int>> expected;
+  for (int type = 0; type < ag::CollisionManager::BroadphaseCount; type++) {
+    collision_manager.set_broadphase(
+      static_cast<ag::CollisionManager::BroadphaseType>(type));
+    std::vector<std::pair<unsigned int, unsigned int>> contacts;
+    for (auto &&contact : collision_manager.collision_check(objects)) {
+      contacts.push_back(std::make_pair(contact.first, contact.second));
+    }
+    std::sort(contacts.begin(), contacts.end());
+    if (type == 0) {
+      expected = contacts;
+      for (auto &&pair : SEAM_PAIRS) {
+        if (!std::binary_search(expected.begin(), expected.end(), pair)) {
+          std::fprintf(stderr, "seam check: %s misses the pair %u, %u\n",
+                       NAMES[type], pair.first, pair.second);
+          return false;
+        }
+      }
+    } else if (contacts != expected) {
+      std::fprintf(stderr, "seam check: %s reports %zu contacts, %s %zu\n",
+                   NAMES[type], contacts.size(), NAMES[0], expected.size());
+      return false;
+    }
+  }
+  std::fprintf(stderr, "seam check: %zu contacts from every broadphase\n",
+               expected.size());
+  return true;
+}
+
+// A game with the given number of asteroids added to its first level and the
+// ship turning and firing. The ship is made immune to asteroids so that the
+// game cannot end part way through a run.
+void simulation_benchmarks(std::size_t count, std::mt19937 &generator) {
+  std::unique_ptr<ag::Simulation> simulation;
+  ag::Input start;
+  start.press(ag::Input::ConfirmButton);
+  ag::Input controls;
+  controls.press(ag::Input::TurnLeftButton);
+  controls.press(ag::Input::FireButton);
+  std::size_t ticks = std::max<std::size_t>(1U, std::min<std::size_t>(
+    60U, TICK_BUDGET / count));
+  measure("simulation_update", "tick", count, ticks,
+          [&] {
+            simulation.reset(new ag::Simulation{1U});
+            simulation->apply_input(start);
+            simulation->update(DT);
+            simulation->get_collision_manager().set_collides(
+              ag::GameObject::PlayerType, ag::GameObject::AsteroidType, false);
+            for (std::size_t i = 0U; i < count; i++) {
+              simulation->add_asteroid(ASTEROID_SIZES[0],
+                                       random_position(generator),
+                                       random_rotation(generator));
+            }
+          },
+          [&] {
+            for (std::size_t tick = 0U; tick < ticks; tick++) {
+              simulation->apply_input(controls);
+              simulation->update(DT);
+            }
+          });
+}
+
+void print_results() {
+#if defined(__AVX__)
+  const char *simd = "AVX";
+#elif defined(__SSE__)
+  const char *simd = "SSE";
+#else
+  const char *simd = "scalar";
+#endif
+  std::printf("{\n  \"compiler\": \"%s\",\n  \"simd\": \"%s\",\n"
+              "  \"results\": [\n", __VERSION__, simd);
+  for (std::size_t i = 0U; i < results.size(); i++) {
+    const Result &result = results[i];
+    std::printf("    {\"name\": \"%s\", \"entities\": %zu, \"op\": \"%s\", "
+                "\"ops\": %llu, \"ns_per_op\": %.2f, \"ops_per_s\": %.0f, "
+                "\"allocs_per_op\": %.3f, \"bytes_per_op\": %.1f}%s\n",
+                result.name.c_str(), result.entities, result.op,
+                static_cast<unsigned long long>(result.ops),
+                result.seconds * 1.0e9 / result.ops,
+                result.ops / result.seconds,
+                static_cast<double>(result.allocations) / result.ops,
+                static_cast<double>(result.bytes) / result.ops,
+                i + 1U < results.size() ? "," : "");
+  }
+  std::printf("  ]\n}\n");
+}
+
+}
+
+// Times the collision, broadphase, spawning and update hot paths at 10 to
+// 100k entities and prints the results as JSON on stdout. An optional
+// argument only runs the benchmarks whose names contain it. It first checks
+// that the broadphases agree across the world's seams, and fails if not.
+int main(int argc, char *argv[]) {
+  name_filter = argc > 1 ? argv[1] : "";
+  if (!check_seam_contacts()) {
+    return 1;
+  }
+  ag::AllocationTracker::set_enabled(true);
+  std::mt19937 generator{1U};
+  for (std::size_t count : ENTITY_COUNTS) {
+    quadtree_benchmarks(count, generator);
+    narrowphase_benchmarks(count, generator);
+    spawn_benchmarks(count, generator);
+    collision_check_benchmarks(count, generator);
+    simulation_benchmarks(count, generator);
+  }
+  print_results();
+  return 0;
+}
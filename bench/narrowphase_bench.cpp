@@ -0,0 +1,334 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include <SFML/System.hpp>
+
+#include "helpers.h"
+#include "polygon.h"
+
+namespace {
+
+const std::size_t CASES = 4096U;
+const unsigned int ROUNDS = 500U;
+const float ARENA_SIZE = 120.0F;
+
+const std::array<sf::Vector2f, 3U> SHIP_SHAPE{
+  sf::Vector2f{0.0F, -10.0F}, sf::Vector2f{-7.5F, 10.0F},
+  sf::Vector2f{7.5F, 10.0F}
+};
+const std::array<sf::Vector2f, 4U> SAUCER_SHAPE{
+  sf::Vector2f{-20.0F, 0.0F}, sf::Vector2f{0.0F, -40.0F},
+  sf::Vector2f{20.0F, 0.0F}, sf::Vector2f{0.0F, 40.0F}
+};
+
+template <std::size_t POINTS>
+ag::Polygon<POINTS> place(const std::array<sf::Vector2f, POINTS> &shape,
+                          sf::Vector2f position, float rotation) {
+  float r_sin = std::sin(rotation);
+  float r_cos = std::cos(rotation);
+  ag::Polygon<POINTS> polygon;
+  for (std::size_t i = 0U; i < POINTS; i++) {
+    polygon.vertices[i] = sf::Vector2f{
+      position.x + shape[i].x * r_cos - shape[i].y * r_sin,
+      position.y + shape[i].x * r_sin + shape[i].y * r_cos
+    };
+  }
+  return polygon;
+}
+
+template <typename Test>
+void run(const char *name, Test test) {
+  unsigned long hits = 0U;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int round = 0U; round < ROUNDS; round++) {
+    for (std::size_t i = 0U; i < CASES; i++) {
+      hits += test(i) ? 1U : 0U;
+    }
+  }
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+  double tests = static_cast<double>(ROUNDS) * CASES;
+  std::printf("%-22s %12.0f tests/s  %5.1f ns/test  %4.1f%% hits\n", name,
+              tests / elapsed.count(), elapsed.count() * 1.0e9 / tests,
+              100.0 * hits / tests);
+}
+
+// The tests the collision manager used before the fixed-size polygons, kept
+// as they were (vertices in vectors passed by value, pow and sqrt) so that
+// both can be timed on the same machine.
+namespace baseline {
+
+std::vector<sf::Vector2f> calculate_normals(
+    std::vector<sf::Vector2f> vertices) {
+  sf::Vector2f side;
+  std::vector<sf::Vector2f> normals;
+  for (unsigned int i = 0; i < vertices.size(); i++) {
+    side = vertices.at((i + 1) % vertices.size()) - vertices.at(i);
+    normals.push_back(sf::Vector2f{-(side.y), (side.x)});
+  }
+  return normals;
+}
+
+bool ships_overlap(sf::Vector2f axis,
+                   std::vector<sf::Vector2f> ship_one_vertices,
+                   std::vector<sf::Vector2f> ship_two_vertices) {
+  float min_one = ag::vector2f_dot_product(axis, ship_one_vertices.at(0));
+  float max_one = min_one;
+  float min_two = ag::vector2f_dot_product(axis, ship_two_vertices.at(0));
+  float max_two = min_one;
+  float dot_product;
+  for (auto vertex : ship_one_vertices) {
+    dot_product = ag::vector2f_dot_product(axis, vertex);
+    min_one = std::min(min_one, dot_product);
+    max_one = std::max(max_one, dot_product);
+  }
+  for (auto vertex : ship_two_vertices) {
+    dot_product = ag::vector2f_dot_product(axis, vertex);
+    min_two = std::min(min_two, dot_product);
+    max_two = std::max(max_two, dot_product);
+  }
+  return max_one < min_two || min_one > max_two;
+}
+
+bool ship_circle_overlap(sf::Vector2f axis,
+                         std::vector<sf::Vector2f> ship_vertices,
+                         sf::Vector2f circle_position, float circle_radius) {
+  float min_one = ag::vector2f_dot_product(axis, ship_vertices.at(0));
+  float max_one = min_one;
+  float dot_product;
+  for (auto vertex : ship_vertices) {
+    dot_product = ag::vector2f_dot_product(axis, vertex);
+    min_one = std::min(min_one, dot_product);
+    max_one = std::max(max_one, dot_product);
+  }
+  sf::Vector2f circle_vertex_one, circle_vertex_two;
+  circle_vertex_one =
+    circle_position - (ag::normalize_vector2f(axis) * circle_radius);
+  circle_vertex_two =
+    circle_position + (ag::normalize_vector2f(axis) * circle_radius);
+  float min_two = ag::vector2f_dot_product(axis, circle_vertex_one);
+  float max_two = ag::vector2f_dot_product(axis, circle_vertex_two);
+  return max_one < min_two || min_one > max_two;
+}
+
+bool ship_ship(std::vector<sf::Vector2f> ship_one_vertices,
+               std::vector<sf::Vector2f> ship_two_vertices) {
+  std::vector<sf::Vector2f> all_axes, ship_one_axes, ship_two_axes;
+  ship_one_axes = calculate_normals(ship_one_vertices);
+  ship_two_axes = calculate_normals(ship_two_vertices);
+  all_axes.insert(all_axes.end(), ship_one_axes.begin(), ship_one_axes.end());
+  all_axes.insert(all_axes.end(), ship_two_axes.begin(), ship_two_axes.end());
+  for (auto axis : all_axes) {
+    if (ships_overlap(axis, ship_one_vertices, ship_two_vertices)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ship_circle(std::vector<sf::Vector2f> ship_vertices,
+                 sf::Vector2f circle_position, float circle_radius) {
+  std::vector<sf::Vector2f> all_axes, ship_axes;
+  ship_axes = calculate_normals(ship_vertices);
+  float distance = circle_radius * 2.0F;
+  float minimum_distance = distance;
+  sf::Vector2f circle_axis;
+  for (auto vertex : ship_vertices) {
+    distance = static_cast<float>(sqrt(pow((vertex.x - circle_position.x), 2) +
+                                       pow((vertex.y - circle_position.y), 2)));
+    if (distance < minimum_distance) {
+      minimum_distance = distance;
+      circle_axis = vertex - circle_position;
+    }
+  }
+  all_axes.insert(all_axes.end(), ship_axes.begin(), ship_axes.end());
+  all_axes.push_back(circle_axis);
+  for (auto axis : all_axes) {
+    if (ship_circle_overlap(axis, ship_vertices, circle_position,
+                            circle_radius)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}
+
+template <std::size_t POINTS>
+std::vector<sf::Vector2f> to_vector(const ag::Polygon<POINTS> &polygon) {
+  return std::vector<sf::Vector2f>(polygon.vertices.begin(),
+                                   polygon.vertices.end());
+}
+
+// Whether an edge normal of either polygon has the second lying wholly below
+// the first, the separation the baseline's ships_overlap cannot see.
+template <std::size_t FIRST, std::size_t SECOND>
+bool second_below_first(const ag::Polygon<FIRST> &first,
+                        const ag::Polygon<SECOND> &second) {
+  std::array<sf::Vector2f, FIRST + SECOND> axes;
+  for (std::size_t edge = 0U; edge < FIRST; edge++) {
+    axes[edge] = ag::edge_normal(first, edge);
+  }
+  for (std::size_t edge = 0U; edge < SECOND; edge++) {
+    axes[FIRST + edge] = ag::edge_normal(second, edge);
+  }
+  for (auto &&axis : axes) {
+    float min_one, max_one, min_two, max_two;
+    ag::project_polygon(first, axis, min_one, max_one);
+    ag::project_polygon(second, axis, min_two, max_two);
+    if (max_two < min_one) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Whether the baseline's ship_circle finds no vertex within twice the radius
+// and so no axis towards the circle. The axis is left zero and normalising
+// it gives NaN, which separates nothing, so a circle off a corner but
+// within every edge's span is taken as touching.
+bool no_circle_axis(const std::vector<sf::Vector2f> &vertices,
+                    sf::Vector2f circle_position, float circle_radius) {
+  for (auto vertex : vertices) {
+    float distance = static_cast<float>(sqrt(
+      pow((vertex.x - circle_position.x), 2) +
+      pow((vertex.y - circle_position.y), 2)));
+    if (distance < circle_radius * 2.0F) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The original ships_overlap started the second shape's maximum projection
+// from the first shape's first vertex, so it never saw the second shape lying
+// wholly below the first on an axis. With a saucer tested first that hid
+// every separating ship edge, and an upright saucer with its tip 15 units
+// under an upright ship's base was reported as touching it.
+bool check_saucer_below_ship() {
+  ag::Polygon<3U> ship = place(SHIP_SHAPE, sf::Vector2f{0.0F, 0.0F}, 0.0F);
+  ag::Polygon<4U> saucer = place(SAUCER_SHAPE, sf::Vector2f{0.0F, 65.0F},
+                                 0.0F);
+  if (ag::polygons_overlap(saucer, ship) ||
+      ag::polygons_overlap(ship, saucer)) {
+    std::fprintf(stderr, "a saucer below a ship is reported as touching\n");
+    return false;
+  }
+  return true;
+}
+
+}
+
+// Checks a saucer and ship placement the original test got wrong and that
+// the baseline tests agree with the new ones, then times both on random
+// ship, saucer and asteroid placements packed closely enough that a good
+// share of them touch.
+int main() {
+  if (!check_saucer_below_ship()) {
+    return 1;
+  }
+  std::mt19937 generator{1U};
+  std::uniform_real_distribution<float> coordinate{0.0F, ARENA_SIZE};
+  std::uniform_real_distribution<float> angle{0.0F, 6.2831853F};
+  std::uniform_real_distribution<float> radius{2.0F, 50.0F};
+  std::vector<ag::Polygon<3U>> ships;
+  std::vector<ag::Polygon<4U>> saucers;
+  std::vector<std::vector<sf::Vector2f>> ship_vertices;
+  std::vector<std::vector<sf::Vector2f>> saucer_vertices;
+  std::vector<sf::Vector2f> circle_positions;
+  std::vector<float> circle_radii;
+  for (std::size_t i = 0U; i < CASES; i++) {
+    ships.push_back(place(SHIP_SHAPE, sf::Vector2f{coordinate(generator),
+                                                   coordinate(generator)},
+                          angle(generator)));
+    saucers.push_back(place(SAUCER_SHAPE, sf::Vector2f{coordinate(generator),
+                                                       coordinate(generator)},
+                            angle(generator)));
+    ship_vertices.push_back(to_vector(ships.back()));
+    saucer_vertices.push_back(to_vector(saucers.back()));
+    circle_positions.push_back(sf::Vector2f{coordinate(generator),
+                                            coordinate(generator)});
+    circle_radii.push_back(radius(generator));
+  }
+  // The baseline may only differ from the new tests where one of its two
+  // bugs reports a pair touching that is not.
+  unsigned int below = 0U;
+  unsigned int off_corner = 0U;
+  for (std::size_t i = 0U; i < CASES; i++) {
+    bool ship_first = ag::polygons_overlap(ships[i], saucers[i]);
+    bool saucer_first = ag::polygons_overlap(saucers[i], ships[i]);
+    bool ship_circle = ag::polygon_circle_overlap(
+      ships[i], circle_positions[i], circle_radii[i]);
+    bool saucer_circle = ag::polygon_circle_overlap(
+      saucers[i], circle_positions[i], circle_radii[i]);
+    bool saucer_first_baseline =
+      baseline::ship_ship(saucer_vertices[i], ship_vertices[i]);
+    bool ship_circle_baseline = baseline::ship_circle(
+      ship_vertices[i], circle_positions[i], circle_radii[i]);
+    bool saucer_circle_baseline = baseline::ship_circle(
+      saucer_vertices[i], circle_positions[i], circle_radii[i]);
+    if (saucer_first_baseline && !saucer_first &&
+        second_below_first(saucers[i], ships[i])) {
+      below++;
+      saucer_first_baseline = saucer_first;
+    }
+    if (ship_circle_baseline && !ship_circle &&
+        no_circle_axis(ship_vertices[i], circle_positions[i],
+                       circle_radii[i])) {
+      off_corner++;
+      ship_circle_baseline = ship_circle;
+    }
+    if (saucer_circle_baseline && !saucer_circle &&
+        no_circle_axis(saucer_vertices[i], circle_positions[i],
+                       circle_radii[i])) {
+      off_corner++;
+      saucer_circle_baseline = saucer_circle;
+    }
+    if (baseline::ship_ship(ship_vertices[i], saucer_vertices[i]) !=
+          ship_first ||
+        saucer_first_baseline != saucer_first ||
+        ship_circle_baseline != ship_circle ||
+        saucer_circle_baseline != saucer_circle) {
+      std::fprintf(stderr, "case %zu: the baseline disagrees\n", i);
+      return 1;
+    }
+  }
+  std::printf("baseline agrees on %zu cases, bar %u saucer/ship pairs with "
+              "the ship below and %u circle tests off a corner\n", CASES,
+              below, off_corner);
+  run("ship_ship", [&](std::size_t i) {
+    return ag::polygons_overlap(ships[i], saucers[i]);
+  });
+  run("ship_ship_baseline", [&](std::size_t i) {
+    return baseline::ship_ship(ship_vertices[i], saucer_vertices[i]);
+  });
+  run("saucer_ship", [&](std::size_t i) {
+    return ag::polygons_overlap(saucers[i], ships[i]);
+  });
+  run("saucer_ship_baseline", [&](std::size_t i) {
+    return baseline::ship_ship(saucer_vertices[i], ship_vertices[i]);
+  });
+  run("ship_circle", [&](std::size_t i) {
+    return ag::polygon_circle_overlap(ships[i], circle_positions[i],
+                                      circle_radii[i]);
+  });
+  run("ship_circle_baseline", [&](std::size_t i) {
+    return baseline::ship_circle(ship_vertices[i], circle_positions[i],
+                                 circle_radii[i]);
+  });
+  run("saucer_circle", [&](std::size_t i) {
+    return ag::polygon_circle_overlap(saucers[i], circle_positions[i],
+                                      circle_radii[i]);
+  });
+  run("saucer_circle_baseline", [&](std::size_t i) {
+    return baseline::ship_circle(saucer_vertices[i], circle_positions[i],
+                                 circle_radii[i]);
+  });
+  return 0;
+}
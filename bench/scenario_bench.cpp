@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "entity_store.h"
+#include "game_object.h"
+#include "scenario.h"
+#include "simulation.h"
+
+namespace {
+
+// Nearest-rank percentile of the sorted tick times, in microseconds.
+double percentile(const std::vector<double> &sorted, double fraction) {
+  std::size_t rank = static_cast<std::size_t>(fraction * sorted.size());
+  return sorted[std::min(rank, sorted.size() - 1U)] * 1.0e6;
+}
+
+void print_times(const char *indent, const char *name,
+                 std::vector<double> &times, const char *separator) {
+  std::sort(times.begin(), times.end());
+  std::printf("%s\"%s\": {\"p50_us\": %.1f, \"p99_us\": %.1f, "
+              "\"max_us\": %.1f}%s\n", indent, name, percentile(times, 0.5),
+              percentile(times, 0.99), times.back() * 1.0e6, separator);
+}
+
+// Runs the scenario's ticks and prints its tick times, whole and per phase.
+void run(ag::Scenario &scenario, const char *separator) {
+  std::fprintf(stderr, "%s\n", scenario.get_name().c_str());
+  ag::Simulation simulation{scenario.get_seed()};
+  scenario.start(simulation);
+  float dt = 1.0F / scenario.get_tick_rate();
+  std::vector<double> ticks;
+  std::array<std::vector<double>, ag::Simulation::PhaseCount> phases;
+  std::size_t peak_objects = 0U;
+  for (unsigned int tick = 0U; tick < scenario.get_tick_count() &&
+       simulation.is_running(); tick++) {
+    scenario.refill(simulation);
+    peak_objects = std::max(peak_objects,
+                            simulation.get_game_objects().size());
+    simulation.apply_input(scenario.get_input());
+    auto start = std::chrono::steady_clock::now();
+    simulation.update(dt);
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+    ticks.push_back(elapsed.count());
+    for (int phase = 0; phase < ag::Simulation::PhaseCount; phase++) {
+      phases[phase].push_back(simulation.get_phase_seconds()[phase]);
+    }
+  }
+  std::printf("    {\"name\": \"%s\", \"seed\": %" PRIu64 ", \"ticks\": %zu, "
+              "\"peak_objects\": %zu, \"final_objects\": %zu, "
+              "\"score\": %u,\n", scenario.get_name().c_str(),
+              scenario.get_seed(), ticks.size(), peak_objects,
+              simulation.get_game_objects().size(),
+              simulation.get_player().get_score());
+  const ag::EntityStore &objects = simulation.get_game_objects();
+  const ag::EntityStore::PoolStats &asteroids =
+    objects.get_pool_stats(ag::GameObject::AsteroidType);
+  const ag::EntityStore::PoolStats &bullets =
+    objects.get_pool_stats(ag::GameObject::BulletType);
+  std::printf("      \"pools\": {\"asteroids\": {\"capacity\": %u, "
+              "\"high_water\": %u}, \"bullets\": {\"capacity\": %u, "
+              "\"high_water\": %u}},\n", asteroids.capacity,
+              asteroids.high_water, bullets.capacity, bullets.high_water);
+  if (ticks.empty()) {
+    std::printf("      \"tick\": null\n    }%s\n", separator);
+    return;
+  }
+  print_times("      ", "tick", ticks, ",");
+  std::printf("      \"phases\": {\n");
+  for (int phase = 0; phase < ag::Simulation::PhaseCount; phase++) {
+    print_times("        ", ag::Simulation::get_phase_name(
+                  static_cast<ag::Simulation::Phase>(phase)), phases[phase],
+                phase + 1 < ag::Simulation::PhaseCount ? "," : "");
+  }
+  std::printf("      }\n    }%s\n", separator);
+}
+
+}
+
+// Plays each scenario file given on the command line for its set number of
+// ticks and prints the p50, p99 and max tick times, whole and for each phase
+// of the update, as JSON on stdout.
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    std::fprintf(stderr, "usage: scenario_bench <scenario file>...\n");
+    return 1;
+  }
+  std::vector<ag::Scenario> scenarios(argc - 1);
+  for (int i = 1; i < argc; i++) {
+    if (!scenarios[i - 1].load(argv[i])) {
+      std::fprintf(stderr, "bad scenario %s\n",
+                   scenarios[i - 1].get_error().c_str());
+      return 1;
+    }
+  }
+  std::printf("{\n  \"scenarios\": [\n");
+  for (std::size_t i = 0U; i < scenarios.size(); i++) {
+    run(scenarios[i], i + 1U < scenarios.size() ? "," : "");
+  }
+  std::printf("  ]\n}\n");
+  return 0;
+}
@@ -0,0 +1,66 @@
+#include "audio_manager.h"
+
+#include <string>
+
+#include <SFML/Audio.hpp>
+
+#include "simulation.h"
+#include "state_manager.h"
+
+namespace ag {
+
+AudioManager::AudioManager() : m_state{StateManager::TitleScreen} {}
+
+bool AudioManager::load_resources(std::string game_bgm,
+                                  std::string collision_sfx,
+                                  std::string gun_sfx) {
+  if (!m_game_bgm.openFromFile(game_bgm) ||
+      !m_collision_sfx_buffer.loadFromFile(collision_sfx) ||
+      !m_gun_sfx_buffer.loadFromFile(gun_sfx)) {
+    return false;
+  }
+  m_game_bgm.setLoop(true);
+  m_collision_sfx.setBuffer(m_collision_sfx_buffer);
+  m_gun_sfx.setBuffer(m_gun_sfx_buffer);
+  return true;
+}
+
+void AudioManager::update(const Simulation &simulation) {
+  StateManager::GameState state = simulation.get_game_state().get_state();
+  if (state != m_state) {
+    change_state(state);
+  }
+  const Simulation::Events &events = simulation.get_events();
+  if (events.shots > 0U) {
+    m_gun_sfx.play();
+  }
+  if (events.contacts > 0U &&
+      m_collision_sfx.getStatus() == sf::Sound::Stopped) {
+    m_collision_sfx.play();
+  }
+}
+
+// The music starts over with every level, drops while paused and stops once
+// a game or level ends.
+void AudioManager::change_state(StateManager::GameState state) {
+  switch (state) {
+    case StateManager::InGame:
+      if (m_state != StateManager::Paused) {
+        m_game_bgm.play();
+      }
+      m_game_bgm.setVolume(FULL_VOLUME);
+      break;
+    case StateManager::Paused:
+      m_game_bgm.setVolume(PAUSED_VOLUME);
+      break;
+    case StateManager::TitleScreen:
+      m_game_bgm.setVolume(FULL_VOLUME);
+      break;
+    default:
+      m_game_bgm.stop();
+      break;
+  }
+  m_state = state;
+}
+
+}
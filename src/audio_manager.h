@@ -0,0 +1,40 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_AUDIO_MANAGER_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_AUDIO_MANAGER_H
+
+#include <string>
+
+#include <SFML/Audio.hpp>
+
+#include "simulation.h"
+#include "state_manager.h"
+
+namespace ag {
+
+// Plays the music and sound effects for what the simulation reports, so the
+// simulation itself never touches an audio device.
+class AudioManager {
+ public:
+  AudioManager();
+  ~AudioManager() {};
+
+  bool load_resources(std::string game_bgm, std::string collision_sfx,
+                      std::string gun_sfx);
+  void update(const Simulation &simulation);
+
+ private:
+  const float PAUSED_VOLUME = 25.0F;
+  const float FULL_VOLUME = 100.0F;
+
+  void change_state(StateManager::GameState state);
+
+  StateManager::GameState m_state;
+  sf::Music m_game_bgm;
+  sf::SoundBuffer m_collision_sfx_buffer;
+  sf::Sound m_collision_sfx;
+  sf::SoundBuffer m_gun_sfx_buffer;
+  sf::Sound m_gun_sfx;
+};
+
+}
+
+#endif
@@ -1,25 +1,42 @@
 #include "display_manager.h"
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 
 #include <SFML/Graphics.hpp>
 
+#include "entity_store.h"
 #include "game_object.h"
+#include "perf_overlay.h"
+#include "profiler.h"
+#include "saucer.h"
 #include "spaceship.h"
 #include "state_manager.h"
 
 namespace ag{
 
-DisplayManager::DisplayManager ()
-  : m_game_window{sf::VideoMode(static_cast<unsigned int>(DISPLAY_SIZE.x),
+DisplayManager::DisplayManager(sf::Vector2f display_size)
+  : DISPLAY_SIZE{display_size},
+    m_game_window{sf::VideoMode(static_cast<unsigned int>(DISPLAY_SIZE.x),
                                 static_cast<unsigned int>(DISPLAY_SIZE.y)),
-                  "Asteroids"}, m_life_sprite{3U}, m_blink_timer{BLINK_TIMER} {
+                  "Asteroids"}, m_life_sprite{3U},
+    m_ship_sprite{Spaceship::POINT_COUNT},
+    m_saucer_sprite{Saucer::POINT_COUNT}, m_perf_overlay{OVERLAY_POSITION},
+    m_shown_score{~0U}, m_shown_level{~0U}, m_blink_timer{BLINK_TIMER} {
   m_life_sprite.setPointCount(3);
   m_life_sprite.setPoint(std::size_t(0U), sf::Vector2f{7.50F, 0.0F});
   m_life_sprite.setPoint(std::size_t(1U), sf::Vector2f{0.0F, 20.0F});
   m_life_sprite.setPoint(std::size_t(2U), sf::Vector2f{15.0F, 20.0F});
   m_life_sprite.setOutlineThickness(1.0F);
   m_life_sprite.setFillColor(sf::Color::Black);
+  m_ship_sprite.setOutlineThickness(1.0F);
+  m_ship_sprite.setFillColor(sf::Color::Black);
+  m_saucer_sprite.setOutlineThickness(1.0F);
+  m_saucer_sprite.setFillColor(sf::Color::Black);
+  m_asteroid_sprite.setOutlineThickness(1.0F);
+  m_asteroid_sprite.setFillColor(sf::Color::Black);
+  m_bullet_sprite.setFillColor(sf::Color::White);
   m_level_label.setCharacterSize(20U);
   m_level_label.setString("LEVEL 1");
   m_level_label.setFillColor(sf::Color::White);
@@ -47,56 +64,58 @@ bool DisplayManager::load_resources(std::string game_font) {
   m_title_text.setFont(m_game_font);
   m_press_enter.setFont(m_game_font);
   m_level_label.setFont(m_game_font);
+  m_perf_overlay.set_font(m_game_font);
   return true;
 }
 
-sf::Vector2f DisplayManager::screen_center() const {
-  return DISPLAY_SIZE / 2.0F;
+sf::Vector2f DisplayManager::display_size() const {
+  return DISPLAY_SIZE;
 }
 
-sf::Vector2f DisplayManager::saucer_spawn_position() const {
-  int position_index = rand() % 2;
-  return SAUCER_SPAWNS.at(position_index);
+sf::Vector2f DisplayManager::screen_center() const {
+  return DISPLAY_SIZE / 2.0F;
 }
 
 bool DisplayManager::poll_event(sf::Event &event) {
   return m_game_window.pollEvent(event);
 }
 
+PerfOverlay &DisplayManager::get_perf_overlay() {
+  return m_perf_overlay;
+}
+
 void DisplayManager::draw_screen(const StateManager &game_state, float dt,
-    const std::vector<std::shared_ptr<GameObject>> &objects,
-    unsigned int level) {
-  std::shared_ptr<Spaceship> player = nullptr;
+    const EntityStore &objects, const Spaceship &player, unsigned int level,
+    float alpha) {
+  ProfileZone zone{"draw_screen"};
   float lives_offset = 20.0F;
   sf::Vector2f offset_vector{0.0F, 0.0F};
   m_game_window.clear(sf::Color::Black);
   if (game_state.game_over()) {
     m_game_window.draw(gameover_string());
   } else if (game_state.in_game() || game_state.paused()) {
-    for (auto object : objects) {
-      m_game_window.draw(*object->get_sprite());
-      if (*object == GameObject::PlayerType) {
-        player = std::dynamic_pointer_cast<Spaceship>(object);
-      }
+    draw_objects(objects, alpha);
+    for (unsigned int i = 0U; i < player.get_lives(); i++) {
+      offset_vector = {(lives_offset * i), 0.0F};
+      m_life_sprite.setPosition(LIFE_POSITION + offset_vector);
+      m_game_window.draw(m_life_sprite);
+    }
+    if (player.get_score() != m_shown_score) {
+      m_shown_score = player.get_score();
+      m_score.setString("SCORE: " + std::to_string(m_shown_score));
     }
-    if (player) {
-      for (unsigned int i = 0U; i < player->get_lives(); i++) {
-        offset_vector = {(lives_offset * i), 0.0F};
-        m_life_sprite.setPosition(LIFE_POSITION + offset_vector);
-        m_game_window.draw(m_life_sprite);
-      }
-      m_score.setString("SCORE: " + std::to_string(player->get_score()));
-      m_game_window.draw(m_score);
-      offset_vector = {0.0F, 0.0F};
+    m_game_window.draw(m_score);
+    offset_vector = {0.0F, 0.0F};
+    if (level != m_shown_level) {
+      m_shown_level = level;
+      m_level_label.setString("LEVEL " + std::to_string(level));
+      m_level_label.setOrigin(m_level_label.getLocalBounds().width / 2.0F,
+                              0.0F);
+      m_level_label.setPosition(LEVEL_POSITION);
     }
-    m_level_label.setString("LEVEL " + std::to_string(level));
-    m_level_label.setOrigin(m_level_label.getLocalBounds().width / 2.0F, 0.0F);
-    m_level_label.setPosition(LEVEL_POSITION);
     m_game_window.draw(m_level_label);
   } else if (game_state.title_screen()) {
-    for (auto object : objects) {
-      m_game_window.draw(*object->get_sprite());
-    }
+    draw_objects(objects, alpha);
     m_title_text.setOrigin(m_title_text.getLocalBounds().width / 2.0F,
                            m_title_text.getLocalBounds().height / 2.0F);
     m_title_text.setPosition(TITLE_POSITION);
@@ -111,64 +130,10 @@ void DisplayManager::draw_screen(const StateManager &game_state, float dt,
       m_blink_timer = BLINK_TIMER;
     }
   }
+  m_perf_overlay.draw(m_game_window);
   m_game_window.display();
 }
 
-void DisplayManager::wrap_object(GameObject &object) {
-  float wrapped_x = object.get_position().x;
-  float wrapped_y = object.get_position().y;
-  if (object.get_position().x <= 0.0F) {
-    wrapped_x = (object.get_position().x + DISPLAY_SIZE.x +
-                 (object.get_radius() * 2.0F));
-  } else if (object.get_position().x >= DISPLAY_SIZE.x) {
-    wrapped_x = (object.get_position().x - DISPLAY_SIZE.x -
-                 (object.get_radius() * 2.0F));
-  }
-  if (object.get_position().y <= 0.0F) {
-    wrapped_y = (object.get_position().y + DISPLAY_SIZE.y +
-                 (object.get_radius() * 2.0F));
-  } else if (object.get_position().y >= DISPLAY_SIZE.y) {
-    wrapped_y = (object.get_position().y - DISPLAY_SIZE.y -
-                 (object.get_radius() * 2.0F));
-  }
-  object.move_to(sf::Vector2f{wrapped_x, wrapped_y});
-}
-
-bool DisplayManager::off_camera(sf::Vector2f position, float radius) const {
-  return position.x < -radius ||
-         position.y < -radius ||
-         position.x > DISPLAY_SIZE.x + radius ||
-         position.y > DISPLAY_SIZE.y + radius;
-}
-
-sf::Vector2f DisplayManager::valid_asteroid_position(
-    const std::vector<std::shared_ptr<GameObject>> &game_objects) const {
-  float old_x, old_y, new_x, new_y, distance;
-  bool invalid;
-  do {
-    invalid = false;
-    new_x = rand() % static_cast<int>(DISPLAY_SIZE.x);
-    new_y = rand() % static_cast<int>(DISPLAY_SIZE.y);
-    if (new_x <= 50.0F || new_x >= DISPLAY_SIZE.x - 50.0F ||
-        new_y <= 50.0F || new_y >= DISPLAY_SIZE.y - 50.0F) {
-      invalid = true;
-    }
-    for (auto object : game_objects) {
-      old_x = object->get_position().x;
-      old_y = object->get_position().y;
-      distance = sqrt(pow((old_x - new_x), 2) + pow((old_y - new_y), 2));
-      if (object->get_object_type() == GameObject::PlayerType &&
-          distance < DISPLAY_SIZE.y / 6.0F) {
-          invalid = true;
-      } else if (object->get_object_type() == GameObject::AsteroidType &&
-                 distance < 110.0F) {
-          invalid = true;
-      }
-    }
-  } while (invalid);
-  return sf::Vector2f{new_x, new_y};
-}
-
 sf::Text DisplayManager::gameover_string() const {
   sf::Text string{"GAME OVER", m_game_font, 100U};
   string.setFillColor(sf::Color::White);
@@ -179,4 +144,87 @@ sf::Text DisplayManager::gameover_string() const {
   return string;
 }
 
-}
\ No newline at end of file
+const std::array<DisplayManager::DrawFunction, GameObject::NullType>
+DisplayManager::DRAW_FUNCTIONS{{
+  &DisplayManager::draw_ship, &DisplayManager::draw_asteroid,
+  &DisplayManager::draw_bullet, &DisplayManager::draw_saucer
+}};
+
+// Objects are drawn at their transform interpolated between the last two
+// ticks, so the picture moves smoothly when frames outpace ticks.
+void DisplayManager::draw_objects(const EntityStore &objects, float alpha) {
+  for (unsigned int i = 0U; i < objects.size(); i++) {
+    (this->*DRAW_FUNCTIONS[objects.types[i]])(objects, i, alpha);
+  }
+}
+
+void DisplayManager::draw_ship(const EntityStore &objects, unsigned int index,
+                               float alpha) {
+  draw_polygon(objects, index, Spaceship::get_shape(), m_ship_sprite, alpha);
+}
+
+void DisplayManager::draw_asteroid(const EntityStore &objects,
+                                   unsigned int index, float alpha) {
+  draw_circle(objects, index, m_asteroid_sprite, alpha);
+}
+
+void DisplayManager::draw_bullet(const EntityStore &objects,
+                                 unsigned int index, float alpha) {
+  draw_circle(objects, index, m_bullet_sprite, alpha);
+}
+
+void DisplayManager::draw_saucer(const EntityStore &objects,
+                                 unsigned int index, float alpha) {
+  draw_polygon(objects, index, Saucer::get_shape(), m_saucer_sprite, alpha);
+}
+
+template <std::size_t POINTS>
+void DisplayManager::draw_polygon(
+    const EntityStore &objects, unsigned int index,
+    const std::array<sf::Vector2f, POINTS> &points, sf::ConvexShape &shape,
+    float alpha) {
+  for (std::size_t i = 0U; i < POINTS; i++) {
+    if (shape.getPoint(i) != points[i]) {
+      shape.setPoint(i, points[i]);
+    }
+  }
+  draw_shape(objects, index, shape, alpha);
+}
+
+void DisplayManager::draw_circle(const EntityStore &objects,
+                                 unsigned int index, sf::CircleShape &shape,
+                                 float alpha) {
+  if (shape.getRadius() != objects.radii[index]) {
+    shape.setRadius(objects.radii[index]);
+  }
+  draw_shape(objects, index, shape, alpha);
+}
+
+// The world wraps at the edges of the display, so a shape over an edge is
+// drawn again on the far side, where it also collides.
+void DisplayManager::draw_shape(const EntityStore &objects,
+                                unsigned int index, sf::Shape &shape,
+                                float alpha) {
+  shape.setOrigin(objects.origins[index]);
+  shape.setPosition(objects.get_interpolated_position(index, alpha));
+  shape.setRotation(objects.get_interpolated_rotation(index, alpha));
+  sf::FloatRect bounds = shape.getGlobalBounds();
+  float shift_x = bounds.left < 0.0F ? DISPLAY_SIZE.x :
+                  bounds.left + bounds.width > DISPLAY_SIZE.x ?
+                  -DISPLAY_SIZE.x : 0.0F;
+  float shift_y = bounds.top < 0.0F ? DISPLAY_SIZE.y :
+                  bounds.top + bounds.height > DISPLAY_SIZE.y ?
+                  -DISPLAY_SIZE.y : 0.0F;
+  m_game_window.draw(shape);
+  if (shift_x != 0.0F) {
+    m_game_window.draw(shape, sf::Transform{}.translate(shift_x, 0.0F));
+  }
+  if (shift_y != 0.0F) {
+    m_game_window.draw(shape, sf::Transform{}.translate(0.0F, shift_y));
+  }
+  if (shift_x != 0.0F && shift_y != 0.0F) {
+    m_game_window.draw(shape, sf::Transform{}.translate(shift_x, shift_y));
+  }
+}
+
+}
@@ -1,44 +1,38 @@
 #ifndef ASTEROIDS_GAME_CODE_INCLUDE_DISPLAY_MANAGER_H
 #define ASTEROIDS_GAME_CODE_INCLUDE_DISPLAY_MANAGER_H
 
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <string>
 
 #include <SFML/Graphics.hpp>
 
+#include "entity_store.h"
 #include "game_object.h"
+#include "perf_overlay.h"
+#include "spaceship.h"
 #include "state_manager.h"
 
 namespace ag {
 
 class DisplayManager {
  public:
-  DisplayManager();
+  explicit DisplayManager(sf::Vector2f display_size);
   ~DisplayManager();
 
   bool load_resources(std::string game_font);
+  sf::Vector2f display_size() const;
   sf::Vector2f screen_center() const;
-  sf::Vector2f saucer_spawn_position() const;
   bool poll_event(sf::Event &event);
+  PerfOverlay &get_perf_overlay();
   void draw_screen(const StateManager &game_state, float dt,
-                   const std::vector<std::shared_ptr<GameObject>> &objects,
-                   unsigned int level);
-  void wrap_object(GameObject &object);
-  bool off_camera(sf::Vector2f position, float radius) const;
-  sf::Vector2f valid_asteroid_position(
-    const std::vector<std::shared_ptr<GameObject>> &game_objects) const;
+                   const EntityStore &objects,
+                   const Spaceship &player, unsigned int level,
+                   float alpha);
 
  private:
-  const sf::Vector2f DISPLAY_SIZE{1280.0F, 720.0F};
-  const std::vector<sf::Vector2f> SAUCER_SPAWNS{
-    sf::Vector2f{
-      -10.0F,
-      std::min(DISPLAY_SIZE.y - DISPLAY_SIZE.y / 10.0F, DISPLAY_SIZE.y - 10.0F)
-    },
-    sf::Vector2f{
-      DISPLAY_SIZE.x + 10.0F,
-      std::max(DISPLAY_SIZE.y / 10.0F, 40.0F)
-    }
-  };
+  const sf::Vector2f DISPLAY_SIZE;
   const sf::Vector2f TITLE_POSITION{DISPLAY_SIZE.x / 2.0F,
                                     DISPLAY_SIZE.y / 5.0F};
   const sf::Vector2f START_POSITION{DISPLAY_SIZE.x / 2.0F,
@@ -46,17 +40,50 @@ class DisplayManager {
   const sf::Vector2f LIFE_POSITION{10.0F, 10.0F};
   const sf::Vector2f LEVEL_POSITION{DISPLAY_SIZE.x / 2.0F, 10.0F};
   const sf::Vector2f SCORE_POSITION{DISPLAY_SIZE.x - 170.0F, 10.0F};
+  const sf::Vector2f OVERLAY_POSITION{10.0F, 40.0F};
   const float BLINK_TIMER = 0.75F;
 
   sf::Text gameover_string() const;
+  using DrawFunction = void (DisplayManager::*)(const EntityStore &objects,
+                                                unsigned int index,
+                                                float alpha);
+
+  // How each type of object is drawn, indexed in ObjectType order.
+  static const std::array<DrawFunction, GameObject::NullType> DRAW_FUNCTIONS;
+
+  void draw_objects(const EntityStore &objects, float alpha);
+  void draw_ship(const EntityStore &objects, unsigned int index, float alpha);
+  void draw_asteroid(const EntityStore &objects, unsigned int index,
+                     float alpha);
+  void draw_bullet(const EntityStore &objects, unsigned int index,
+                   float alpha);
+  void draw_saucer(const EntityStore &objects, unsigned int index,
+                   float alpha);
+  template <std::size_t POINTS>
+  void draw_polygon(const EntityStore &objects, unsigned int index,
+                    const std::array<sf::Vector2f, POINTS> &points,
+                    sf::ConvexShape &shape, float alpha);
+  void draw_circle(const EntityStore &objects, unsigned int index,
+                   sf::CircleShape &shape, float alpha);
+  void draw_shape(const EntityStore &objects, unsigned int index,
+                  sf::Shape &shape, float alpha);
 
   sf::RenderWindow m_game_window;
   sf::Font m_game_font;
   sf::ConvexShape m_life_sprite;
+  sf::ConvexShape m_ship_sprite;
+  sf::ConvexShape m_saucer_sprite;
+  sf::CircleShape m_asteroid_sprite;
+  sf::CircleShape m_bullet_sprite;
   sf::Text m_level_label;
   sf::Text m_score;
   sf::Text m_title_text;
   sf::Text m_press_enter;
+  PerfOverlay m_perf_overlay;
+  // The score and level the HUD text was last set to; it is only rebuilt
+  // when they change.
+  unsigned int m_shown_score;
+  unsigned int m_shown_level;
   float m_blink_timer;
 };
 
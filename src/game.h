@@ -1,50 +1,56 @@
 #ifndef ASTEROIDS_GAME_CODE_INCLUDE_GAME_H
 #define ASTEROIDS_GAME_CODE_INCLUDE_GAME_H
 
+#include <cstdint>
 #include <string>
-#include <memory>
 
 #include <SFML/Graphics.hpp>
 
-#include "game_object.h"
-#include "spaceship.h"
-#include "collision_manager.h"
+#include "audio_manager.h"
 #include "display_manager.h"
-#include "state_manager.h"
+#include "input.h"
+#include "perf_overlay.h"
+#include "replay.h"
+#include "simulation.h"
 
 namespace ag {
 
+// The windowed front-end: feeds keyboard and window events, or a replay, to
+// the simulation, then draws and plays what it reports. Every tick's input is
+// recorded so the session can be saved as a replay.
 class Game {
  public:
-  Game();
+  explicit Game(std::uint64_t seed, float tick_rate);
   ~Game() {};
 
   bool load_resources(std::string game_bgm, std::string collision_sfx,
                       std::string ship_gun_sfx, std::string game_font);
   bool is_running() const;
-  void process_input(float dt);
+  // Takes input from the replay instead of the keyboard until it runs out.
+  void play(const Replay &replay);
+  const Replay &get_recording() const;
+  void process_input();
+  // Advances the simulation by one tick of dt seconds.
   void update(float dt);
+  // Draws a frame; frame_time is the real time since the last frame and
+  // alpha how far the frame lies between the last tick and the next.
+  void draw(float frame_time, float alpha);
 
  private:
-  const unsigned int STARTING_ASTEROIDS = 3U;
-  const float L_ASTEROID = 50.0F;
-  const float M_ASTEROID = 25.0F;
-  const float S_ASTEROID = 12.5F;
-  const float SAUCER_INTERVAL = 5.0F;
+  const sf::Keyboard::Key BROADPHASE_KEY = sf::Keyboard::F2;
+  const sf::Keyboard::Key OVERLAY_KEY = sf::Keyboard::F3;
 
-  void spawn_asteroids(unsigned int asteroid_count);
-  void reset_game();
+  Input held_keys() const;
+  Input::Button menu_button(sf::Keyboard::Key key) const;
 
-  StateManager m_game_state;
-  CollisionManager m_collision_manager;
+  Simulation m_simulation;
   DisplayManager m_display_manager;
-  std::shared_ptr<Spaceship> m_player;
-  std::vector<std::shared_ptr<GameObject>> m_game_objects;
-  std::string m_ship_gun_sfx;
-  unsigned int m_asteroid_count;
-  unsigned int m_next_object_id;
-  unsigned int m_difficulty;
-  float m_saucer_timer;
+  AudioManager m_audio_manager;
+  Input m_pending_input;
+  Replay m_replay;
+  Replay m_recording;
+  // Collision work summed over the ticks run since the last frame was drawn.
+  PerfOverlay::FrameStats m_frame_stats;
 };
 
 }
@@ -0,0 +1,121 @@
+#include <cinttypes>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <SFML/System.hpp>
+
+#include "allocation_tracker.h"
+#include "input.h"
+#include "profiler.h"
+#include "replay.h"
+#include "simulation.h"
+#include "state_manager.h"
+
+namespace {
+
+void report_allocations(unsigned int frame) {
+  std::printf("frame %u allocated:\n", frame);
+  for (std::size_t i = 0U; i < ag::AllocationTracker::get_zone_count(); i++) {
+    const ag::AllocationTracker::ZoneCounts &zone =
+      ag::AllocationTracker::get_zones()[i];
+    std::printf("  %s: %llu allocations, %llu bytes\n",
+                zone.zone != nullptr ? zone.zone : "(no zone)",
+                static_cast<unsigned long long>(zone.counts.allocations),
+                static_cast<unsigned long long>(zone.counts.bytes));
+  }
+}
+
+}
+
+// Runs the simulation without a window, audio device or font, then prints how
+// fast the frames ran and where the game ended up.
+//
+// Usage: asteroids_headless [frames] [tick rate] [seed] [record file] steps
+// the given number of frames with the ship turning and firing, starting a new
+// game whenever one ends, and can save that input as a replay.
+// asteroids_headless --replay <file> plays a recorded session back as fast as
+// it will go. Either way the same input and seed always end in the same place.
+// With AG_TRACE set to a path, a Chrome trace of the run is written there.
+// With AG_ALLOC_CHECK set to a number of warm-up frames, every simulation
+// frame after those must not allocate: the run reports the frames that did,
+// and where the first one allocated, and fails if there were any.
+int main(int argc, char *argv[]) {
+  std::string replay_flag = "--replay";
+  const char *trace_file = std::getenv("AG_TRACE");
+  ag::Profiler::set_enabled(trace_file != nullptr);
+  const char *alloc_check = std::getenv("AG_ALLOC_CHECK");
+  unsigned int warm_up = alloc_check != nullptr ? std::stoul(alloc_check) : 0U;
+  ag::AllocationTracker::set_enabled(alloc_check != nullptr);
+  unsigned int allocating_frames = 0U;
+  ag::AllocationTracker::Counts steady_counts{0U, 0U};
+  bool replaying = argc > 2 && argv[1] == replay_flag;
+  ag::Replay replay;
+  if (replaying && !replay.load(argv[2])) {
+    std::fprintf(stderr, "could not load replay %s\n", argv[2]);
+    return 1;
+  } else if (!replaying) {
+    replay = ag::Replay{argc > 3 ? std::stoull(argv[3]) : 1U,
+                        argc > 2 ? std::stof(argv[2]) : 60.0F};
+  }
+  unsigned int frames = replaying ? replay.get_tick_count() :
+                        argc > 1 ? std::stoul(argv[1]) : 10000U;
+  float dt = 1.0F / replay.get_tick_rate();
+  ag::Simulation simulation{replay.get_seed()};
+  const ag::StateManager &game_state = simulation.get_game_state();
+  ag::Input input;
+  sf::Clock clock;
+  for (unsigned int frame = 0U; frame < frames; frame++) {
+    ag::ProfileZone zone{"tick"};
+    if (replaying) {
+      input = replay.next();
+    } else {
+      input.clear();
+      input.press(ag::Input::TurnLeftButton);
+      input.press(ag::Input::FireButton);
+      input.press(ag::Input::ConfirmButton,
+                  game_state.title_screen() || game_state.game_over());
+      replay.record(input);
+    }
+    ag::AllocationTracker::begin_frame();
+    simulation.apply_input(input);
+    simulation.update(dt);
+    ag::AllocationTracker::Counts counts =
+      ag::AllocationTracker::get_frame_counts();
+    if (alloc_check != nullptr && frame >= warm_up && counts.allocations > 0U) {
+      if (allocating_frames++ == 0U) {
+        report_allocations(frame);
+      }
+      steady_counts.allocations += counts.allocations;
+      steady_counts.bytes += counts.bytes;
+    }
+  }
+  float seconds = clock.getElapsedTime().asSeconds();
+  std::printf("%u frames at dt %.4f in %.3f s: %.0f frames/s\n", frames, dt,
+              seconds, frames / seconds);
+  std::printf("seed %" PRIu64 ": level %u, score %u, %u objects\n",
+              replay.get_seed(), simulation.get_level(),
+              simulation.get_player().get_score(),
+              static_cast<unsigned int>(simulation.get_game_objects().size()));
+  if (!replaying && argc > 4 && !replay.save(argv[4])) {
+    std::fprintf(stderr, "could not save replay %s\n", argv[4]);
+    return 1;
+  }
+  if (trace_file != nullptr && !ag::Profiler::write_chrome_trace(trace_file)) {
+    std::fprintf(stderr, "could not save trace %s\n", trace_file);
+    return 1;
+  }
+  if (alloc_check != nullptr) {
+    std::printf("%u of %u frames after warm-up allocated: %llu allocations, "
+                "%llu bytes\n", allocating_frames,
+                frames > warm_up ? frames - warm_up : 0U,
+                static_cast<unsigned long long>(steady_counts.allocations),
+                static_cast<unsigned long long>(steady_counts.bytes));
+    if (allocating_frames > 0U) {
+      return 1;
+    }
+  }
+  return 0;
+}
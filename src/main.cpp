@@ -1,13 +1,42 @@
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
 #include <string>
 
 #include <SFML/System.hpp>
 
+#include "fixed_timestep.h"
 #include "game.h"
 #include "helpers.h"
+#include "profiler.h"
+#include "replay.h"
 
-int main() {
-  std::srand(std::time(nullptr));
-  ag::Game game{};
+// Usage: asteroids [seed] [record file], or asteroids --replay <file>.
+// Without a seed the time picks one; it is printed either way. A record file
+// receives the session's replay when the game closes. With AG_TRACE set to a
+// path, a Chrome trace of the session is written there on close.
+int main(int argc, char *argv[]) {
+  const float TICK_RATE = 60.0F;
+  const unsigned int MAX_CATCH_UP_STEPS = 5U;
+  std::string replay_flag = "--replay";
+  const char *trace_file = std::getenv("AG_TRACE");
+  ag::Profiler::set_enabled(trace_file != nullptr);
+  ag::Replay replay{static_cast<std::uint64_t>(std::time(nullptr)), TICK_RATE};
+  std::string record_file;
+  if (argc > 2 && argv[1] == replay_flag) {
+    if (!replay.load(argv[2])) {
+      std::fprintf(stderr, "could not load replay %s\n", argv[2]);
+      return 1;
+    }
+  } else if (argc > 1) {
+    replay = ag::Replay{std::stoull(argv[1]), TICK_RATE};
+    record_file = argc > 2 ? argv[2] : "";
+  }
+  std::printf("seed %" PRIu64 "\n", replay.get_seed());
+  ag::Game game{replay.get_seed(), replay.get_tick_rate()};
+  game.play(replay);
   std::string game_bgm_file = "res/orchestral.ogg";
   std::string collision_sfx_file = "res/boom.wav";
   std::string ship_gun_sfx_file = "res/gun.wav";
@@ -16,12 +45,26 @@ int main() {
                            game_font_file)) {
     return 1;
   }
+  ag::FixedTimestep timestep{replay.get_tick_rate(), MAX_CATCH_UP_STEPS};
   sf::Clock frame_clock;
-  sf::Time dt;
+  float frame_time;
   do {
-    dt = frame_clock.restart();
-    game.process_input(dt.asSeconds());
-    game.update(dt.asSeconds());
+    ag::ProfileZone zone{"frame"};
+    frame_time = frame_clock.restart().asSeconds();
+    game.process_input();
+    for (unsigned int steps = timestep.advance(frame_time); steps > 0U;
+         steps--) {
+      game.update(timestep.get_dt());
+    }
+    game.draw(frame_time, timestep.get_alpha());
   } while (game.is_running());
+  if (!record_file.empty() && !game.get_recording().save(record_file)) {
+    std::fprintf(stderr, "could not save replay %s\n", record_file.c_str());
+    return 1;
+  }
+  if (trace_file != nullptr && !ag::Profiler::write_chrome_trace(trace_file)) {
+    std::fprintf(stderr, "could not save trace %s\n", trace_file);
+    return 1;
+  }
   return 0;
 }
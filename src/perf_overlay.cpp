@@ -0,0 +1,178 @@
+#include "perf_overlay.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <SFML/Graphics.hpp>
+
+#include "entity_store.h"
+#include "game_object.h"
+
+namespace ag {
+
+namespace {
+
+// The graph's frame and target line come first in the vertex array, then one
+// line segment between each pair of neighbouring samples.
+const std::size_t FRAME_VERTICES = 8U;
+const std::size_t TARGET_VERTICES = 2U;
+const std::size_t SAMPLES_START = FRAME_VERTICES + TARGET_VERTICES;
+const sf::Color FRAME_COLOR{96U, 96U, 96U};
+const sf::Color TARGET_COLOR{0U, 160U, 0U};
+
+}
+
+PerfOverlay::PerfOverlay(sf::Vector2f position)
+    : m_position{position}, m_visible{false}, m_frame_times{},
+      m_sorted_times{}, m_next_frame{0U}, m_frame_count{0U},
+      m_graph{sf::Lines, SAMPLES_START + 2U * (HISTORY - 1U)}, m_shown{},
+      m_refresh_timer{0.0F} {
+  const sf::Vector2f corners[] = {
+    m_position, m_position + sf::Vector2f{GRAPH_SIZE.x, 0.0F},
+    m_position + GRAPH_SIZE, m_position + sf::Vector2f{0.0F, GRAPH_SIZE.y}
+  };
+  for (std::size_t i = 0U; i < 4U; i++) {
+    m_graph[2U * i].position = corners[i];
+    m_graph[2U * i + 1U].position = corners[(i + 1U) % 4U];
+    m_graph[2U * i].color = FRAME_COLOR;
+    m_graph[2U * i + 1U].color = FRAME_COLOR;
+  }
+  float target_y = m_position.y + GRAPH_SIZE.y -
+                   GRAPH_SIZE.y * TARGET_TIME / GRAPH_MAX_TIME;
+  m_graph[FRAME_VERTICES].position = sf::Vector2f{m_position.x, target_y};
+  m_graph[FRAME_VERTICES + 1U].position =
+    sf::Vector2f{m_position.x + GRAPH_SIZE.x, target_y};
+  m_graph[FRAME_VERTICES].color = TARGET_COLOR;
+  m_graph[FRAME_VERTICES + 1U].color = TARGET_COLOR;
+  m_text.setCharacterSize(14U);
+  m_text.setFillColor(sf::Color::White);
+  m_text.setPosition(m_position + sf::Vector2f{0.0F, GRAPH_SIZE.y + 6.0F});
+}
+
+void PerfOverlay::set_font(const sf::Font &font) {
+  m_text.setFont(font);
+}
+
+bool PerfOverlay::is_visible() const {
+  return m_visible;
+}
+
+void PerfOverlay::toggle() {
+  m_visible = !m_visible;
+  m_refresh_timer = 0.0F;
+}
+
+// Frame times are kept while the overlay is hidden so that the graph is full
+// as soon as it is shown; everything drawn is left alone until then.
+void PerfOverlay::update(const PerfOverlay::FrameStats &stats) {
+  m_frame_times[m_next_frame] = stats.frame_time;
+  m_next_frame = (m_next_frame + 1U) % HISTORY;
+  if (m_frame_count < HISTORY) {
+    m_frame_count++;
+  }
+  if (!m_visible) {
+    return;
+  }
+  refresh_graph();
+  m_refresh_timer -= stats.frame_time;
+  if (m_refresh_timer <= 0.0F) {
+    refresh_text(stats);
+    m_refresh_timer = REFRESH_INTERVAL;
+  }
+}
+
+void PerfOverlay::draw(sf::RenderTarget &target) const {
+  if (m_visible) {
+    target.draw(m_graph);
+    target.draw(m_text);
+  }
+}
+
+// The newest sample sits at the right edge; segments without two samples yet
+// collapse onto the bottom left corner.
+void PerfOverlay::refresh_graph() {
+  const float step = GRAPH_SIZE.x / static_cast<float>(HISTORY - 1U);
+  const float bottom = m_position.y + GRAPH_SIZE.y;
+  std::size_t oldest = (m_next_frame + HISTORY - m_frame_count) % HISTORY;
+  std::size_t empty = HISTORY - m_frame_count;
+  for (std::size_t sample = 0U; sample < HISTORY; sample++) {
+    sf::Vector2f point{m_position.x, bottom};
+    if (sample >= empty) {
+      float time = m_frame_times[(oldest + sample - empty) % HISTORY];
+      point.x += step * static_cast<float>(sample);
+      point.y -= GRAPH_SIZE.y * std::min(time / GRAPH_MAX_TIME, 1.0F);
+    }
+    if (sample > 0U) {
+      m_graph[SAMPLES_START + 2U * sample - 1U].position =
+        sample > empty ? point : sf::Vector2f{m_position.x, bottom};
+    }
+    if (sample + 1U < HISTORY) {
+      m_graph[SAMPLES_START + 2U * sample].position = point;
+    }
+  }
+}
+
+void PerfOverlay::refresh_text(const PerfOverlay::FrameStats &stats) {
+  float total = 0.0F;
+  for (std::size_t i = 0U; i < m_frame_count; i++) {
+    total += m_frame_times[i];
+  }
+  std::copy(m_frame_times.begin(), m_frame_times.begin() + m_frame_count,
+            m_sorted_times.begin());
+  std::size_t p99_rank = m_frame_count * 99U / 100U;
+  std::nth_element(m_sorted_times.begin(), m_sorted_times.begin() + p99_rank,
+                   m_sorted_times.begin() + m_frame_count);
+  std::array<std::uint64_t, FieldCount> values;
+  values[FpsField] = total > 0.0F ?
+    static_cast<std::uint64_t>(m_frame_count / total + 0.5F) : 0U;
+  values[P99Field] =
+    static_cast<std::uint64_t>(m_sorted_times[p99_rank] * 1.0e4F + 0.5F);
+  values[PlayerField] = stats.object_counts[GameObject::PlayerType];
+  values[AsteroidField] = stats.object_counts[GameObject::AsteroidType];
+  values[BulletField] = stats.object_counts[GameObject::BulletType];
+  values[SaucerField] = stats.object_counts[GameObject::SaucerType];
+  values[AsteroidCapacityField] =
+    stats.pools[GameObject::AsteroidType].capacity;
+  values[AsteroidPeakField] = stats.pools[GameObject::AsteroidType].high_water;
+  values[BulletCapacityField] = stats.pools[GameObject::BulletType].capacity;
+  values[BulletPeakField] = stats.pools[GameObject::BulletType].high_water;
+  values[CandidateField] = stats.candidates;
+  values[TestField] = stats.tests;
+  values[HitField] = stats.hits;
+  values[AllocationField] = stats.allocations;
+  if (values == m_shown && !m_text.getString().isEmpty()) {
+    return;
+  }
+  m_shown = values;
+  char text[320];
+  std::snprintf(text, sizeof(text),
+                "FPS %llu  P99 %llu.%llu MS\n"
+                "SHIPS %llu  ASTEROIDS %llu  BULLETS %llu  SAUCERS %llu\n"
+                "POOLS ASTEROIDS %llu/%llu PEAK %llu  "
+                "BULLETS %llu/%llu PEAK %llu\n"
+                "CANDIDATES %llu  TESTS %llu  HITS %llu\n"
+                "ALLOCATIONS %llu",
+                static_cast<unsigned long long>(values[FpsField]),
+                static_cast<unsigned long long>(values[P99Field] / 10U),
+                static_cast<unsigned long long>(values[P99Field] % 10U),
+                static_cast<unsigned long long>(values[PlayerField]),
+                static_cast<unsigned long long>(values[AsteroidField]),
+                static_cast<unsigned long long>(values[BulletField]),
+                static_cast<unsigned long long>(values[SaucerField]),
+                static_cast<unsigned long long>(values[AsteroidField]),
+                static_cast<unsigned long long>(values[AsteroidCapacityField]),
+                static_cast<unsigned long long>(values[AsteroidPeakField]),
+                static_cast<unsigned long long>(values[BulletField]),
+                static_cast<unsigned long long>(values[BulletCapacityField]),
+                static_cast<unsigned long long>(values[BulletPeakField]),
+                static_cast<unsigned long long>(values[CandidateField]),
+                static_cast<unsigned long long>(values[TestField]),
+                static_cast<unsigned long long>(values[HitField]),
+                static_cast<unsigned long long>(values[AllocationField]));
+  m_text.setString(text);
+}
+
+}
@@ -0,0 +1,86 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_PERF_OVERLAY_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_PERF_OVERLAY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <SFML/Graphics.hpp>
+
+#include "entity_store.h"
+#include "game_object.h"
+
+namespace ag {
+
+// A toggleable readout of how frames are going: a graph of recent frame
+// times, frames/s and the 99th percentile frame time, objects of each type,
+// collision work and allocations. The graph is one vertex array drawn in a
+// single call and the text is only rebuilt, a few times a second at most,
+// when something it shows has changed.
+class PerfOverlay {
+ public:
+  // What one frame did, gathered by the front-end.
+  struct FrameStats {
+    float frame_time;
+    std::array<unsigned int, GameObject::NullType> object_counts;
+    std::array<EntityStore::PoolStats, GameObject::NullType> pools;
+    unsigned int candidates;
+    unsigned int tests;
+    unsigned int hits;
+    std::uint64_t allocations;
+  };
+
+  explicit PerfOverlay(sf::Vector2f position);
+  ~PerfOverlay() {};
+
+  void set_font(const sf::Font &font);
+  bool is_visible() const;
+  void toggle();
+  void update(const PerfOverlay::FrameStats &stats);
+  void draw(sf::RenderTarget &target) const;
+
+ private:
+  enum Field {
+    FpsField,
+    P99Field,
+    PlayerField,
+    AsteroidField,
+    BulletField,
+    SaucerField,
+    AsteroidCapacityField,
+    AsteroidPeakField,
+    BulletCapacityField,
+    BulletPeakField,
+    CandidateField,
+    TestField,
+    HitField,
+    AllocationField,
+    FieldCount
+  };
+
+  static const std::size_t HISTORY = 120U;
+
+  const sf::Vector2f GRAPH_SIZE{240.0F, 60.0F};
+  // Frame times at the top of the graph and on its marker line, in seconds.
+  const float GRAPH_MAX_TIME = 1.0F / 20.0F;
+  const float TARGET_TIME = 1.0F / 60.0F;
+  const float REFRESH_INTERVAL = 0.25F;
+
+  void refresh_graph();
+  void refresh_text(const PerfOverlay::FrameStats &stats);
+
+  const sf::Vector2f m_position;
+  bool m_visible;
+  std::array<float, HISTORY> m_frame_times;
+  std::array<float, HISTORY> m_sorted_times;
+  std::size_t m_next_frame;
+  std::size_t m_frame_count;
+  sf::VertexArray m_graph;
+  sf::Text m_text;
+  std::array<std::uint64_t, FieldCount> m_shown;
+  float m_refresh_timer;
+};
+
+}
+
+#endif
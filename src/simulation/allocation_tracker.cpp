@@ -0,0 +1,101 @@
+#include "allocation_tracker.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace ag {
+
+namespace {
+
+// Constant-initialised, so the hooks below can use it from any thread at any
+// time without allocating.
+struct ThreadCounts {
+  AllocationTracker::Counts frame;
+  std::array<AllocationTracker::ZoneCounts, AllocationTracker::MAX_ZONES>
+    zones;
+  std::size_t zone_count;
+  const char *zone;
+};
+
+thread_local ThreadCounts thread_counts{};
+
+}
+
+std::atomic<bool> AllocationTracker::s_enabled{false};
+
+void AllocationTracker::set_enabled(bool enabled) {
+  s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void AllocationTracker::begin_frame() {
+  thread_counts.frame = Counts{0U, 0U};
+  thread_counts.zone_count = 0U;
+}
+
+AllocationTracker::Counts AllocationTracker::get_frame_counts() {
+  return thread_counts.frame;
+}
+
+std::size_t AllocationTracker::get_zone_count() {
+  return thread_counts.zone_count;
+}
+
+const std::array<AllocationTracker::ZoneCounts, AllocationTracker::MAX_ZONES> &
+AllocationTracker::get_zones() {
+  return thread_counts.zones;
+}
+
+const char *AllocationTracker::enter_zone(const char *zone) {
+  const char *outer = thread_counts.zone;
+  thread_counts.zone = zone;
+  return outer;
+}
+
+void AllocationTracker::leave_zone(const char *outer) {
+  thread_counts.zone = outer;
+}
+
+void AllocationTracker::record(std::size_t bytes) {
+  if (!is_enabled()) {
+    return;
+  }
+  ThreadCounts &counts = thread_counts;
+  counts.frame.allocations++;
+  counts.frame.bytes += bytes;
+  std::size_t i = 0U;
+  while (i < counts.zone_count && counts.zones[i].zone != counts.zone) {
+    i++;
+  }
+  if (i == counts.zone_count) {
+    if (i == MAX_ZONES) {
+      return;
+    }
+    counts.zones[i] = ZoneCounts{counts.zone, Counts{0U, 0U}};
+    counts.zone_count++;
+  }
+  counts.zones[i].counts.allocations++;
+  counts.zones[i].counts.bytes += bytes;
+}
+
+}
+
+void *operator new(std::size_t size) {
+  ag::AllocationTracker::record(size);
+  void *memory = std::malloc(size == 0U ? 1U : size);
+  if (memory == nullptr) {
+    throw std::bad_alloc{};
+  }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+  std::free(memory);
+}
@@ -0,0 +1,55 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_ALLOCATION_TRACKER_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_ALLOCATION_TRACKER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ag {
+
+// Counts heap allocations and the bytes they asked for, per thread and per
+// frame, by replacing the global operator new. Each allocation is also
+// charged to the innermost ProfileZone open on its thread, so a frame that
+// allocates can say where. Tracking is off until enabled; while it is off an
+// allocation costs one relaxed atomic load more than usual.
+class AllocationTracker {
+ public:
+  struct Counts {
+    std::uint64_t allocations;
+    std::uint64_t bytes;
+  };
+
+  // Counts charged to a zone this frame; a null zone is allocations made
+  // outside of every zone.
+  struct ZoneCounts {
+    const char *zone;
+    AllocationTracker::Counts counts;
+  };
+
+  // Zones past this many in one frame still count towards the frame's total.
+  static const std::size_t MAX_ZONES = 32U;
+
+  static bool is_enabled() {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
+  static void set_enabled(bool enabled);
+  // Zeroes the calling thread's counts.
+  static void begin_frame();
+  // The calling thread's counts since begin_frame.
+  static AllocationTracker::Counts get_frame_counts();
+  static std::size_t get_zone_count();
+  static const std::array<ZoneCounts, MAX_ZONES> &get_zones();
+  // Makes zone the one new allocations are charged to and returns the one it
+  // replaced, which leave_zone puts back.
+  static const char *enter_zone(const char *zone);
+  static void leave_zone(const char *outer);
+  static void record(std::size_t bytes);
+
+ private:
+  static std::atomic<bool> s_enabled;
+};
+
+}
+
+#endif
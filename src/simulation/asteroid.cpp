@@ -0,0 +1,53 @@
+#include "asteroid.h"
+
+#include <limits>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "command_buffer.h"
+#include "entity_store.h"
+#include "game_object.h"
+
+namespace ag {
+
+namespace {
+
+const float ASTEROID_SPEED = 25.0F;
+const float OUTLINE_THICKNESS = 1.0F;
+
+}
+
+ObjectSpawn Asteroid::make(float size, sf::Vector2f position,
+                           float rotation) {
+  return ObjectSpawn{
+    GameObject::AsteroidType, position, rotation,
+    GameObject::heading(rotation) * ASTEROID_SPEED, size,
+    sf::Vector2f{size, size}, std::numeric_limits<float>::infinity(),
+    GameObject::NullType
+  };
+}
+
+unsigned int Asteroid::spawn(EntityStore &store, float size,
+                             sf::Vector2f position, float rotation) {
+  return store.add(make(size, position, rotation));
+}
+
+void Asteroid::spawn_child(const EntityStore &store, unsigned int index,
+                           float direction, CommandBuffer &commands) {
+  ObjectSpawn child = make(store.radii[index] / 2.0F, store.positions[index],
+                           store.rotations[index] + direction);
+  child.position += child.velocity * (child.radius / ASTEROID_SPEED);
+  commands.spawn(child);
+}
+
+// The origin sits on the center, so rotation does not move the circle.
+sf::FloatRect Asteroid::get_bounds(const EntityStore &store,
+                                   unsigned int index) {
+  sf::Vector2f position = store.positions[index];
+  float extent = store.radii[index] + OUTLINE_THICKNESS;
+  return sf::FloatRect{position.x - extent, position.y - extent,
+                       2.0F * extent, 2.0F * extent};
+}
+
+}
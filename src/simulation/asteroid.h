@@ -0,0 +1,33 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_ASTEROID_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_ASTEROID_H
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "command_buffer.h"
+#include "entity_store.h"
+
+namespace ag {
+
+// Asteroids drift in a straight line at a fixed speed, and split in two when
+// the simulation finds a large enough one destroyed.
+class Asteroid {
+ public:
+  static const unsigned int SCORE_VALUE = 100U;
+
+  // An asteroid of the given radius heading along its rotation.
+  static ObjectSpawn make(float size, sf::Vector2f position, float rotation);
+  // Adds an asteroid and returns its index.
+  static unsigned int spawn(EntityStore &store, float size,
+                            sf::Vector2f position, float rotation);
+  // Records one half of the asteroid at index, turned by direction degrees
+  // and moved clear of the middle.
+  static void spawn_child(const EntityStore &store, unsigned int index,
+                          float direction, CommandBuffer &commands);
+  static sf::FloatRect get_bounds(const EntityStore &store,
+                                  unsigned int index);
+};
+
+}
+
+#endif
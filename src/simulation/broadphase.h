@@ -0,0 +1,57 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_BROADPHASE_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_BROADPHASE_H
+
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+namespace ag {
+
+class Broadphase {
+ public:
+  // An object that may overlap the queried bounds.
+  struct Candidate {
+    unsigned int index;
+  };
+
+  // The collision layer bits an object sits on and the layers it collides
+  // with. A pair only becomes a candidate when each side's mask holds the
+  // other's layer.
+  struct Filter {
+    unsigned int layer;
+    unsigned int mask;
+
+    bool accepts(const Filter &other) const {
+      return (mask & other.layer) != 0U && (other.mask & layer) != 0U;
+    }
+  };
+
+  virtual ~Broadphase() {};
+
+  // A frame inserts every object, calls build once, retrieves candidates for
+  // each object and finally calls clear. The index is the object's position
+  // in this frame's list; the id stays the same for as long as it lives, is
+  // small enough to index an array with, and only goes to another object
+  // after it has been removed.
+  // Broadphases rebuilt every frame drop their contents in clear, while those
+  // maintained incrementally treat insert as a move and keep an object until
+  // remove is called with its id. Objects whose filters reject each other are
+  // never returned as candidates.
+  virtual void clear()=0;
+  virtual void insert(unsigned int index, unsigned int id,
+                      sf::FloatRect bounds, Filter filter)=0;
+  virtual void remove(unsigned int id) {};
+  virtual void build() {};
+  virtual void retrieve(unsigned int index, sf::FloatRect bounds,
+                        Filter filter,
+                        std::vector<Candidate> &candidates) const=0;
+  // Candidates for bounds that need not belong to any inserted object, such
+  // as an object's image across an edge of the world. Only valid after build.
+  virtual void retrieve_area(sf::FloatRect bounds, Filter filter,
+                             std::vector<Candidate> &candidates) const=0;
+};
+
+}
+
+#endif
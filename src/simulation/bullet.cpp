@@ -0,0 +1,48 @@
+#include "bullet.h"
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "entity_store.h"
+#include "game_object.h"
+
+namespace ag {
+
+namespace {
+
+const float BULLET_SPEED = 250.0F;
+const float BULLET_SIZE = 2.0F;
+const sf::Vector2f BULLET_ORIGIN{BULLET_SIZE, 0.0F};
+
+}
+
+ObjectSpawn Bullet::make(GameObject::ObjectType parent_type, float rotation,
+                         sf::Vector2f ship_velocity,
+                         sf::Vector2f spawn_position, float lifetime) {
+  return ObjectSpawn{
+    GameObject::BulletType, spawn_position, rotation,
+    ship_velocity + (GameObject::heading(rotation) * BULLET_SPEED),
+    BULLET_SIZE, BULLET_ORIGIN, lifetime, parent_type
+  };
+}
+
+unsigned int Bullet::spawn(EntityStore &store,
+                           GameObject::ObjectType parent_type, float rotation,
+                           sf::Vector2f ship_velocity,
+                           sf::Vector2f spawn_position, float lifetime) {
+  return store.add(make(parent_type, rotation, ship_velocity, spawn_position,
+                        lifetime));
+}
+
+// The origin sits on the rim, so the circle's center is found by
+// transforming the center of its local box.
+sf::FloatRect Bullet::get_bounds(const EntityStore &store,
+                                 unsigned int index) {
+  sf::Vector2f center = GameObject::transform_point(
+    store.positions[index], store.rotations[index], BULLET_ORIGIN,
+    sf::Vector2f{BULLET_SIZE, BULLET_SIZE});
+  return sf::FloatRect{center.x - BULLET_SIZE, center.y - BULLET_SIZE,
+                       2.0F * BULLET_SIZE, 2.0F * BULLET_SIZE};
+}
+
+}
@@ -0,0 +1,32 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_BULLET_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_BULLET_H
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "entity_store.h"
+#include "game_object.h"
+
+namespace ag {
+
+// Bullets fly straight on from the gun that fired them, adding its velocity
+// to their own, until they hit something or their lifetime runs out.
+class Bullet {
+ public:
+  // A bullet leaving spawn_position along rotation, for a command buffer or
+  // the store to add.
+  static ObjectSpawn make(GameObject::ObjectType parent_type, float rotation,
+                          sf::Vector2f ship_velocity,
+                          sf::Vector2f spawn_position, float lifetime);
+  // Adds a bullet and returns its index.
+  static unsigned int spawn(EntityStore &store,
+                            GameObject::ObjectType parent_type,
+                            float rotation, sf::Vector2f ship_velocity,
+                            sf::Vector2f spawn_position, float lifetime);
+  static sf::FloatRect get_bounds(const EntityStore &store,
+                                  unsigned int index);
+};
+
+}
+
+#endif
@@ -0,0 +1,83 @@
+#include "circle_kernel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX__) || defined(__SSE__)
+#include <immintrin.h>
+#endif
+
+#include <SFML/System.hpp>
+
+namespace ag {
+
+void CirclePairs::clear() {
+  first_x.clear();
+  first_y.clear();
+  first_radius.clear();
+  second_x.clear();
+  second_y.clear();
+  second_radius.clear();
+}
+
+void CirclePairs::push_back(sf::Vector2f first_position, float first_radius,
+                            sf::Vector2f second_position,
+                            float second_radius) {
+  first_x.push_back(first_position.x);
+  first_y.push_back(first_position.y);
+  this->first_radius.push_back(first_radius);
+  second_x.push_back(second_position.x);
+  second_y.push_back(second_position.y);
+  this->second_radius.push_back(second_radius);
+}
+
+std::size_t CirclePairs::size() const {
+  return first_x.size();
+}
+
+void circle_circle_batch(const CirclePairs &pairs,
+                         std::vector<std::uint32_t> &hit_mask) {
+  std::size_t count = pairs.size();
+  hit_mask.assign((count + 31U) / 32U, 0U);
+  std::size_t i = 0U;
+#if defined(__AVX__)
+  for (; i + 8U <= count; i += 8U) {
+    __m256 delta_x = _mm256_sub_ps(_mm256_loadu_ps(&pairs.first_x[i]),
+                                   _mm256_loadu_ps(&pairs.second_x[i]));
+    __m256 delta_y = _mm256_sub_ps(_mm256_loadu_ps(&pairs.first_y[i]),
+                                   _mm256_loadu_ps(&pairs.second_y[i]));
+    __m256 reach = _mm256_add_ps(_mm256_loadu_ps(&pairs.first_radius[i]),
+                                 _mm256_loadu_ps(&pairs.second_radius[i]));
+    __m256 distance = _mm256_add_ps(_mm256_mul_ps(delta_x, delta_x),
+                                    _mm256_mul_ps(delta_y, delta_y));
+    __m256 hits = _mm256_cmp_ps(distance, _mm256_mul_ps(reach, reach),
+                                _CMP_LE_OQ);
+    hit_mask[i / 32U] |=
+      static_cast<std::uint32_t>(_mm256_movemask_ps(hits)) << (i % 32U);
+  }
+#elif defined(__SSE__)
+  for (; i + 4U <= count; i += 4U) {
+    __m128 delta_x = _mm_sub_ps(_mm_loadu_ps(&pairs.first_x[i]),
+                                _mm_loadu_ps(&pairs.second_x[i]));
+    __m128 delta_y = _mm_sub_ps(_mm_loadu_ps(&pairs.first_y[i]),
+                                _mm_loadu_ps(&pairs.second_y[i]));
+    __m128 reach = _mm_add_ps(_mm_loadu_ps(&pairs.first_radius[i]),
+                              _mm_loadu_ps(&pairs.second_radius[i]));
+    __m128 distance = _mm_add_ps(_mm_mul_ps(delta_x, delta_x),
+                                 _mm_mul_ps(delta_y, delta_y));
+    __m128 hits = _mm_cmple_ps(distance, _mm_mul_ps(reach, reach));
+    hit_mask[i / 32U] |=
+      static_cast<std::uint32_t>(_mm_movemask_ps(hits)) << (i % 32U);
+  }
+#endif
+  for (; i < count; i++) {
+    if (circles_overlap(pairs.first_x[i], pairs.first_y[i],
+                        pairs.first_radius[i], pairs.second_x[i],
+                        pairs.second_y[i], pairs.second_radius[i])) {
+      hit_mask[i / 32U] |= 1U << (i % 32U);
+    }
+  }
+}
+
+}
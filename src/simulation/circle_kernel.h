@@ -0,0 +1,50 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_CIRCLE_KERNEL_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_CIRCLE_KERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System.hpp>
+
+namespace ag {
+
+// Circle against circle candidate pairs stored as structure of arrays so that
+// circle_circle_batch can load several pairs per instruction.
+struct CirclePairs {
+  std::vector<float> first_x;
+  std::vector<float> first_y;
+  std::vector<float> first_radius;
+  std::vector<float> second_x;
+  std::vector<float> second_y;
+  std::vector<float> second_radius;
+
+  void clear();
+  void push_back(sf::Vector2f first_position, float first_radius,
+                 sf::Vector2f second_position, float second_radius);
+  std::size_t size() const;
+};
+
+inline bool circles_overlap(float first_x, float first_y, float first_radius,
+                            float second_x, float second_y,
+                            float second_radius) {
+  float delta_x = first_x - second_x;
+  float delta_y = first_y - second_y;
+  float reach = first_radius + second_radius;
+  return delta_x * delta_x + delta_y * delta_y <= reach * reach;
+}
+
+// Tests every pair and sets bit i % 32 of hit_mask[i / 32] when pair i
+// overlaps. Uses AVX or SSE when the compiler targets them and falls back to
+// circles_overlap otherwise; every path gives the same answers.
+void circle_circle_batch(const CirclePairs &pairs,
+                         std::vector<std::uint32_t> &hit_mask);
+
+inline bool batch_hit(const std::vector<std::uint32_t> &hit_mask,
+                      std::size_t pair) {
+  return (hit_mask[pair / 32U] >> (pair % 32U)) & 1U;
+}
+
+}
+
+#endif
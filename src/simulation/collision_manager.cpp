@@ -0,0 +1,341 @@
+#include "collision_manager.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "broadphase.h"
+#include "circle_kernel.h"
+#include "entity_store.h"
+#include "game_object.h"
+#include "helpers.h"
+#include "polygon.h"
+#include "profiler.h"
+#include "quadtree.h"
+#include "saucer.h"
+#include "spaceship.h"
+#include "spatial_grid.h"
+#include "sweep_and_prune.h"
+
+namespace ag {
+
+namespace {
+
+// Tests one pair of objects whose types are known, with the collider moved
+// by offset.
+using PairTest = bool (*)(const EntityStore &objects, unsigned int object,
+                          unsigned int collider, sf::Vector2f offset);
+
+template <typename Shape, typename Other>
+bool polygon_polygon(const EntityStore &objects, unsigned int object,
+                     unsigned int collider, sf::Vector2f offset) {
+  Polygon<Other::POINT_COUNT> other = Other::get_polygon(objects, collider);
+  other.translate(offset);
+  return polygons_overlap(Shape::get_polygon(objects, object), other);
+}
+
+template <typename Shape>
+bool polygon_circle(const EntityStore &objects, unsigned int object,
+                    unsigned int collider, sf::Vector2f offset) {
+  return polygon_circle_overlap(Shape::get_polygon(objects, object),
+                                objects.positions[collider] + offset,
+                                objects.radii[collider]);
+}
+
+template <typename Other>
+bool circle_polygon(const EntityStore &objects, unsigned int object,
+                    unsigned int collider, sf::Vector2f offset) {
+  return polygon_circle_overlap(Other::get_polygon(objects, collider),
+                                objects.positions[object] - offset,
+                                objects.radii[object]);
+}
+
+bool circle_circle(const EntityStore &objects, unsigned int object,
+                   unsigned int collider, sf::Vector2f offset) {
+  sf::Vector2f collider_position = objects.positions[collider] + offset;
+  return circles_overlap(objects.positions[object].x,
+                         objects.positions[object].y, objects.radii[object],
+                         collider_position.x, collider_position.y,
+                         objects.radii[collider]);
+}
+
+// The narrowphase test for every pair of types, indexed by the object's type
+// and then the collider's, in ObjectType order: player, asteroid, bullet,
+// saucer. Asteroids and bullets are circles, and pairs of them go through
+// circle_circle_batch instead of the table.
+constexpr PairTest PAIR_TESTS[GameObject::NullType][GameObject::NullType] = {
+  {polygon_polygon<Spaceship, Spaceship>, polygon_circle<Spaceship>,
+   polygon_circle<Spaceship>, polygon_polygon<Spaceship, Saucer>},
+  {circle_polygon<Spaceship>, circle_circle, circle_circle,
+   circle_polygon<Saucer>},
+  {circle_polygon<Spaceship>, circle_circle, circle_circle,
+   circle_polygon<Saucer>},
+  {polygon_polygon<Saucer, Spaceship>, polygon_circle<Saucer>,
+   polygon_circle<Saucer>, polygon_polygon<Saucer, Saucer>}
+};
+
+constexpr bool IS_CIRCLE[GameObject::NullType] = {false, true, true, false};
+
+// The shift, along one axis of a world of the given size, that carries
+// bounds crossing an edge to their image across it, or zero if they cross
+// neither edge.
+float edge_shift(float low, float high, float size) {
+  if (high > size) {
+    return -size;
+  }
+  if (low < 0.0F) {
+    return size;
+  }
+  return 0.0F;
+}
+
+// The edge shifts of bounds on both axes.
+sf::Vector2f edge_shifts(sf::FloatRect bounds, sf::Vector2f world_size) {
+  return sf::Vector2f{
+    edge_shift(bounds.left, bounds.left + bounds.width, world_size.x),
+    edge_shift(bounds.top, bounds.top + bounds.height, world_size.y)};
+}
+
+// Whether an object with the given edge shifts queries its image moved by
+// shift. It takes the edges it crosses, and along an axis where it crosses
+// neither, either way as well: an object over the left edge may meet one
+// over the bottom edge only at the corner.
+bool queries_image(sf::Vector2f edges, sf::Vector2f shift) {
+  bool axis_x = shift.x == 0.0F || edges.x == 0.0F || shift.x == edges.x;
+  bool axis_y = shift.y == 0.0F || edges.y == 0.0F || shift.y == edges.y;
+  bool crosses = (edges.x != 0.0F && shift.x == edges.x) ||
+                 (edges.y != 0.0F && shift.y == edges.y);
+  return axis_x && axis_y && crosses;
+}
+
+}
+
+CollisionManager::CollisionManager(sf::Vector2f display_size)
+  : m_quadtree{sf::FloatRect(0.0F, 0.0F, display_size.x, display_size.y)},
+    m_loose_quadtree{sf::FloatRect(0.0F, 0.0F, display_size.x, display_size.y),
+                     LOOSENESS},
+    m_grid{display_size}, m_world_size{display_size},
+    m_broadphase_type{QuadTreeBroadphase},
+    m_owner_rules{true}, m_stats{0U, 0U, 0U, 0U, 0U} {
+  m_collision_masks.fill((1U << GameObject::NullType) - 1U);
+  set_collides(GameObject::AsteroidType, GameObject::AsteroidType, false);
+  set_collides(GameObject::BulletType, GameObject::BulletType, false);
+}
+
+const std::vector<CollisionManager::Contact> &
+CollisionManager::collision_check(const EntityStore &objects) {
+  Broadphase &collidables = broadphase();
+  m_contacts.clear();
+  m_tests.clear();
+  m_circle_pairs.clear();
+  m_circle_tests.clear();
+  m_stats = Stats{0U, 0U, 0U, 0U, 0U};
+  unsigned int count = static_cast<unsigned int>(objects.size());
+  {
+    ProfileZone zone{"broadphase_build"};
+    for (unsigned int i = 0U; i < count; i++) {
+      collidables.insert(i, objects.handles[i].get_slot(), objects.bounds[i],
+                         get_filter(objects, i));
+    }
+    collidables.build();
+  }
+  {
+    ProfileZone zone{"query_and_narrowphase"};
+    for (unsigned int i = 0U; i < count; i++) {
+      m_candidates.clear();
+      collidables.retrieve(i, objects.bounds[i], get_filter(objects, i),
+                           m_candidates);
+      unsigned int candidates = static_cast<unsigned int>(std::count_if(
+        m_candidates.begin(), m_candidates.end(),
+        [i](const Broadphase::Candidate &candidate)
+        { return candidate.index > i; }));
+      m_stats.queries++;
+      m_stats.candidates += candidates;
+      m_stats.max_candidates = std::max(m_stats.max_candidates, candidates);
+      for (auto &&candidate : m_candidates) {
+        if (candidate.index > i) {
+          test_pair(objects, i, candidate.index, sf::Vector2f{0.0F, 0.0F});
+        }
+      }
+      test_images(collidables, objects, i);
+    }
+  }
+  {
+    ProfileZone zone{"circle_batch"};
+    circle_circle_batch(m_circle_pairs, m_circle_hits);
+    for (std::size_t pair = 0U; pair < m_circle_tests.size(); pair++) {
+      m_tests[m_circle_tests[pair]].hit = batch_hit(m_circle_hits, pair);
+    }
+    for (auto &&test : m_tests) {
+      if (test.hit) {
+        m_contacts.push_back(Contact{std::min(test.object, test.collider),
+                                     std::max(test.object, test.collider)});
+      }
+    }
+  }
+  m_stats.tests = static_cast<unsigned int>(m_tests.size());
+  m_stats.hits = static_cast<unsigned int>(m_contacts.size());
+  collidables.clear();
+  return m_contacts;
+}
+
+void CollisionManager::remove(EntityHandle handle) {
+  m_quadtree.remove(handle.get_slot());
+  m_loose_quadtree.remove(handle.get_slot());
+  m_grid.remove(handle.get_slot());
+  m_sweep_and_prune.remove(handle.get_slot());
+}
+
+CollisionManager::BroadphaseType CollisionManager::get_broadphase() const {
+  return m_broadphase_type;
+}
+
+void CollisionManager::set_broadphase(CollisionManager::BroadphaseType type) {
+  m_broadphase_type = type;
+}
+
+bool CollisionManager::get_collides(GameObject::ObjectType first,
+                                    GameObject::ObjectType second) const {
+  return (m_collision_masks.at(first) & (1U << second)) != 0U;
+}
+
+void CollisionManager::set_collides(GameObject::ObjectType first,
+                                    GameObject::ObjectType second,
+                                    bool collides) {
+  if (collides) {
+    m_collision_masks.at(first) |= 1U << second;
+    m_collision_masks.at(second) |= 1U << first;
+  } else {
+    m_collision_masks.at(first) &= ~(1U << second);
+    m_collision_masks.at(second) &= ~(1U << first);
+  }
+}
+
+bool CollisionManager::get_owner_rules() const {
+  return m_owner_rules;
+}
+
+void CollisionManager::set_owner_rules(bool owner_rules) {
+  m_owner_rules = owner_rules;
+}
+
+unsigned int CollisionManager::get_pair_count() const {
+  return m_sweep_and_prune.get_pair_count();
+}
+
+const CollisionManager::Stats &CollisionManager::get_stats() const {
+  return m_stats;
+}
+
+Broadphase &CollisionManager::broadphase() {
+  switch (m_broadphase_type) {
+  case LooseQuadTreeBroadphase:
+    return m_loose_quadtree;
+  case GridBroadphase:
+    return m_grid;
+  case SweepAndPruneBroadphase:
+    return m_sweep_and_prune;
+  case QuadTreeBroadphase:
+  default:
+    return m_quadtree;
+  }
+}
+
+Broadphase::Filter CollisionManager::get_filter(const EntityStore &objects,
+                                                unsigned int index) const {
+  GameObject::ObjectType type = objects.types[index];
+  Broadphase::Filter filter{1U << type, m_collision_masks.at(type)};
+  if (m_owner_rules && type == GameObject::BulletType) {
+    filter.mask &= ~(1U << objects.parent_types[index]);
+  }
+  return filter;
+}
+
+bool CollisionManager::bounds_overlap(const EntityStore &objects,
+                                      unsigned int object,
+                                      unsigned int collider,
+                                      sf::Vector2f offset) const {
+  sf::FloatRect collider_bounds = objects.bounds[collider];
+  collider_bounds.left += offset.x;
+  collider_bounds.top += offset.y;
+  return objects.bounds[object].intersects(collider_bounds);
+}
+
+// Tests the pair now, or queues it for the circle batch, if the collider
+// moved by offset overlaps the object's bounds.
+void CollisionManager::test_pair(const EntityStore &objects,
+                                 unsigned int object, unsigned int collider,
+                                 sf::Vector2f offset) {
+  if (!bounds_overlap(objects, object, collider, offset)) {
+    return;
+  }
+  Test test{object, collider, false};
+  if (!IS_CIRCLE[objects.types[object]] ||
+      !IS_CIRCLE[objects.types[collider]]) {
+    test.hit = narrowphase(objects, object, collider, offset);
+  } else {
+    m_circle_tests.push_back(m_tests.size());
+    m_circle_pairs.push_back(objects.positions[object], objects.radii[object],
+                             objects.positions[collider] + offset,
+                             objects.radii[collider]);
+  }
+  m_tests.push_back(test);
+}
+
+// The world wraps at exactly its size, so an object whose bounds cross an
+// edge also reaches across it. Each such image is queried like an object of
+// its own, and whatever it finds is tested with the collider brought back
+// beside the object. A pair whose images both get queried is found from
+// both, and only the lower index keeps it. Image queries count in the stats
+// like any other, with only the candidates kept. Objects are far smaller
+// than the world, so a pair meets across at most one seam or corner.
+void CollisionManager::test_images(const Broadphase &collidables,
+                                   const EntityStore &objects,
+                                   unsigned int index) {
+  sf::FloatRect bounds = objects.bounds[index];
+  sf::Vector2f edges = edge_shifts(bounds, m_world_size);
+  if (edges.x == 0.0F && edges.y == 0.0F) {
+    return;
+  }
+  const float steps[3] = {0.0F, 1.0F, -1.0F};
+  for (float step_y : steps) {
+    for (float step_x : steps) {
+      sf::Vector2f shift{step_x * m_world_size.x, step_y * m_world_size.y};
+      if (!queries_image(edges, shift)) {
+        continue;
+      }
+      sf::FloatRect image{bounds.left + shift.x, bounds.top + shift.y,
+                          bounds.width, bounds.height};
+      m_candidates.clear();
+      collidables.retrieve_area(image, get_filter(objects, index),
+                                m_candidates);
+      unsigned int candidates = 0U;
+      for (auto &&candidate : m_candidates) {
+        unsigned int collider = candidate.index;
+        if (collider == index ||
+            (collider < index &&
+             queries_image(edge_shifts(objects.bounds[collider],
+                                       m_world_size), -shift))) {
+          continue;
+        }
+        candidates++;
+        test_pair(objects, index, collider, -shift);
+      }
+      m_stats.queries++;
+      m_stats.candidates += candidates;
+      m_stats.max_candidates = std::max(m_stats.max_candidates, candidates);
+    }
+  }
+}
+
+// Only called for pairs whose bounds overlap.
+bool CollisionManager::narrowphase(const EntityStore &objects,
+                                   unsigned int object, unsigned int collider,
+                                   sf::Vector2f offset) const {
+  return PAIR_TESTS[objects.types[object]][objects.types[collider]](
+    objects, object, collider, offset);
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_COLLISION_MANAGER_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_COLLISION_MANAGER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "broadphase.h"
+#include "circle_kernel.h"
+#include "entity_store.h"
+#include "game_object.h"
+#include "polygon.h"
+#include "quadtree.h"
+#include "spatial_grid.h"
+#include "sweep_and_prune.h"
+
+namespace ag {
+
+class CollisionManager {
+ public:
+  // A collision found by collision_check between the objects at indices
+  // "first" and "second", with first < second. Each unordered pair is tested
+  // once and reported at most once; an object may appear in several contacts.
+  struct Contact {
+    unsigned int first;
+    unsigned int second;
+  };
+
+  // Broadphase pairs handed to the narrowphase during the last frame, those
+  // whose bounds overlapped and so had their shapes tested, and the contacts
+  // found. Queries count every object and every image of one across an
+  // edge; a candidate counts once, from the query that keeps its pair.
+  struct Stats {
+    unsigned int queries;
+    unsigned int candidates;
+    unsigned int max_candidates;
+    unsigned int tests;
+    unsigned int hits;
+  };
+
+  enum BroadphaseType {
+    QuadTreeBroadphase,
+    LooseQuadTreeBroadphase,
+    GridBroadphase,
+    SweepAndPruneBroadphase,
+    BroadphaseCount
+  };
+
+  explicit CollisionManager(sf::Vector2f display_size);
+  ~CollisionManager() {};
+
+  // Reads each object's bounds as refresh_bounds last left them. The world
+  // wraps at the size the manager was built with, so objects meet across its
+  // edges, whichever broadphase is in use.
+  const std::vector<Contact> &collision_check(const EntityStore &objects);
+  // Broadphases know objects by their handle's slot. One that keeps objects
+  // from frame to frame must be told when an object dies, before its slot
+  // goes to a new object.
+  void remove(EntityHandle handle);
+  CollisionManager::BroadphaseType get_broadphase() const;
+  void set_broadphase(CollisionManager::BroadphaseType type);
+  // Whether objects of the two types are ever tested against each other. The
+  // matrix is symmetric; asteroids pass through asteroids and bullets through
+  // bullets unless configured otherwise.
+  bool get_collides(GameObject::ObjectType first,
+                    GameObject::ObjectType second) const;
+  void set_collides(GameObject::ObjectType first,
+                    GameObject::ObjectType second, bool collides);
+  // With owner rules on, a bullet ignores objects of its parent's type, so a
+  // saucer's bullets pass through saucers and the player's through the ship.
+  bool get_owner_rules() const;
+  void set_owner_rules(bool owner_rules);
+  // Overlapping pairs found by the last sweep and prune pass.
+  unsigned int get_pair_count() const;
+  const CollisionManager::Stats &get_stats() const;
+
+ private:
+  // A candidate pair awaiting its narrowphase result. Circle pairs are
+  // resolved together by circle_circle_batch once every candidate is known.
+  struct Test {
+    unsigned int object;
+    unsigned int collider;
+    bool hit;
+  };
+
+  Broadphase &broadphase();
+  Broadphase::Filter get_filter(const EntityStore &objects,
+                                unsigned int index) const;
+  bool bounds_overlap(const EntityStore &objects, unsigned int object,
+                      unsigned int collider, sf::Vector2f offset) const;
+  void test_pair(const EntityStore &objects, unsigned int object,
+                 unsigned int collider, sf::Vector2f offset);
+  void test_images(const Broadphase &collidables, const EntityStore &objects,
+                   unsigned int index);
+  bool narrowphase(const EntityStore &objects, unsigned int object,
+                   unsigned int collider, sf::Vector2f offset) const;
+
+  const float LOOSENESS = 2.0F;
+
+  QuadTree<10U, 5U> m_quadtree;
+  QuadTree<10U, 5U> m_loose_quadtree;
+  SpatialGrid m_grid;
+  SweepAndPrune m_sweep_and_prune;
+  const sf::Vector2f m_world_size;
+  CollisionManager::BroadphaseType m_broadphase_type;
+  std::array<unsigned int, GameObject::NullType> m_collision_masks;
+  bool m_owner_rules;
+  std::vector<Broadphase::Candidate> m_candidates;
+  std::vector<Test> m_tests;
+  CirclePairs m_circle_pairs;
+  std::vector<std::size_t> m_circle_tests;
+  std::vector<std::uint32_t> m_circle_hits;
+  std::vector<Contact> m_contacts;
+  CollisionManager::Stats m_stats;
+};
+
+}
+
+#endif
\ No newline at end of file
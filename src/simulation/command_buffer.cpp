@@ -0,0 +1,39 @@
+#include "command_buffer.h"
+
+#include <vector>
+
+#include "entity_store.h"
+
+namespace ag {
+
+const std::vector<ObjectSpawn> &CommandBuffer::get_spawns() const {
+  return m_spawns;
+}
+
+const std::vector<EntityHandle> &CommandBuffer::get_destroys() const {
+  return m_destroys;
+}
+
+const std::vector<CommandBuffer::Score> &CommandBuffer::get_scores() const {
+  return m_scores;
+}
+
+void CommandBuffer::spawn(const ObjectSpawn &spawn) {
+  m_spawns.push_back(spawn);
+}
+
+void CommandBuffer::destroy(EntityHandle handle) {
+  m_destroys.push_back(handle);
+}
+
+void CommandBuffer::score(EntityHandle target, unsigned int points) {
+  m_scores.push_back(CommandBuffer::Score{target, points});
+}
+
+void CommandBuffer::clear() {
+  m_spawns.clear();
+  m_destroys.clear();
+  m_scores.clear();
+}
+
+}
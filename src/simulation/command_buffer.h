@@ -0,0 +1,45 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_COMMAND_BUFFER_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_COMMAND_BUFFER_H
+
+#include <vector>
+
+#include "entity_store.h"
+
+namespace ag {
+
+// Changes that one pass over the objects wants made to anything other than
+// the rows it owns: objects to add, objects to destroy and points to score.
+// Each worker of a pass records into its own buffer, so recording needs no
+// locks, and the simulation applies every buffer in worker order at the end
+// of the pass. As long as workers take contiguous ranges in order, the
+// outcome is the same however many there are. Clearing keeps the buffers'
+// storage, so recording allocates only until a game reaches its peak.
+class CommandBuffer {
+ public:
+  // Points for hitting the target, awarded at most once per target in a
+  // batch however many commands name it.
+  struct Score {
+    EntityHandle target;
+    unsigned int points;
+  };
+
+  CommandBuffer() {};
+  ~CommandBuffer() {};
+
+  const std::vector<ObjectSpawn> &get_spawns() const;
+  const std::vector<EntityHandle> &get_destroys() const;
+  const std::vector<CommandBuffer::Score> &get_scores() const;
+  void spawn(const ObjectSpawn &spawn);
+  void destroy(EntityHandle handle);
+  void score(EntityHandle target, unsigned int points);
+  void clear();
+
+ private:
+  std::vector<ObjectSpawn> m_spawns;
+  std::vector<EntityHandle> m_destroys;
+  std::vector<CommandBuffer::Score> m_scores;
+};
+
+}
+
+#endif
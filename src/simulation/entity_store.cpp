@@ -0,0 +1,284 @@
+#include "entity_store.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "asteroid.h"
+#include "bullet.h"
+#include "game_object.h"
+#include "saucer.h"
+#include "spaceship.h"
+
+namespace ag {
+
+namespace {
+
+// Sweeps one component, moving the entries of objects that survive down over
+// those of destroyed ones.
+template <typename T>
+void compact_component(std::vector<T> &component,
+                       const std::vector<std::uint8_t> &destroyed,
+                       std::size_t first) {
+  std::size_t kept = first;
+  for (std::size_t i = first; i < component.size(); i++) {
+    if (!destroyed[i]) {
+      component[kept++] = component[i];
+    }
+  }
+  component.resize(kept);
+}
+
+using VerticesFunction = void (*)(EntityStore &store, unsigned int index);
+
+// Each type's outline transform, indexed in ObjectType order; circles have
+// no outline.
+constexpr VerticesFunction VERTICES_FUNCTIONS[GameObject::NullType] = {
+  Spaceship::refresh_vertices, nullptr, nullptr, Saucer::refresh_vertices
+};
+
+using BoundsFunction = sf::FloatRect (*)(const EntityStore &store,
+                                         unsigned int index);
+
+// Each type's bounds, indexed in ObjectType order. Polygon types bound their
+// outline, so it has to be refreshed first.
+constexpr BoundsFunction BOUNDS_FUNCTIONS[GameObject::NullType] = {
+  Spaceship::get_bounds, Asteroid::get_bounds, Bullet::get_bounds,
+  Saucer::get_bounds
+};
+
+}
+
+std::size_t EntityStore::size() const {
+  return types.size();
+}
+
+unsigned int EntityStore::add(GameObject::ObjectType type,
+                              sf::Vector2f position, float rotation,
+                              sf::Vector2f velocity, float radius,
+                              sf::Vector2f origin) {
+  if (m_free_slots.empty() && m_slots.size() > EntityHandle::SLOT_MASK) {
+    return NOT_FOUND;
+  }
+  EntityStore::PoolStats &pool = m_pools[type];
+  if (pool.live == pool.capacity) {
+    grow_pool(type);
+  }
+  pool.live++;
+  pool.high_water = std::max(pool.high_water, pool.live);
+  std::uint32_t slot;
+  if (m_free_slots.empty()) {
+    slot = static_cast<std::uint32_t>(m_slots.size());
+    m_slots.push_back(Slot{0U, 0U});
+  } else {
+    slot = m_free_slots.back();
+    m_free_slots.pop_back();
+  }
+  m_slots[slot].index = static_cast<unsigned int>(types.size());
+  float wrapped_rotation = GameObject::wrap_rotation(rotation);
+  handles.push_back(EntityHandle{
+    (m_slots[slot].generation << EntityHandle::SLOT_BITS) | slot});
+  types.push_back(type);
+  positions.push_back(position);
+  velocities.push_back(velocity);
+  rotations.push_back(wrapped_rotation);
+  radii.push_back(radius);
+  bounds.push_back(sf::FloatRect{});
+  vertices.push_back(std::array<sf::Vector2f, MAX_VERTICES>{});
+  moved.push_back(1U);
+  destroyed.push_back(0U);
+  ttls.push_back(std::numeric_limits<float>::infinity());
+  parent_types.push_back(GameObject::NullType);
+  gun_cooldowns.push_back(0.0F);
+  shooting.push_back(0U);
+  aim_rotations.push_back(0.0F);
+  aim_velocities.push_back(sf::Vector2f{0.0F, 0.0F});
+  origins.push_back(origin);
+  previous_positions.push_back(position);
+  previous_rotations.push_back(wrapped_rotation);
+  return static_cast<unsigned int>(types.size() - 1U);
+}
+
+unsigned int EntityStore::add(const ObjectSpawn &spawn) {
+  unsigned int index = add(spawn.type, spawn.position, spawn.rotation,
+                           spawn.velocity, spawn.radius, spawn.origin);
+  if (index == NOT_FOUND) {
+    return NOT_FOUND;
+  }
+  ttls[index] = spawn.ttl;
+  parent_types[index] = spawn.parent_type;
+  return index;
+}
+
+unsigned int EntityStore::find(EntityHandle handle) const {
+  std::uint32_t slot = handle.get_slot();
+  if (slot >= m_slots.size() ||
+      m_slots[slot].generation != handle.get_generation()) {
+    return NOT_FOUND;
+  }
+  return m_slots[slot].index;
+}
+
+bool EntityStore::is_alive(EntityHandle handle) const {
+  unsigned int index = find(handle);
+  return index != NOT_FOUND && !destroyed[index];
+}
+
+void EntityStore::move_to(unsigned int index, sf::Vector2f position) {
+  previous_positions[index] += position - positions[index];
+  positions[index] = position;
+  moved[index] = 1U;
+}
+
+void EntityStore::rotate(unsigned int index, float angle) {
+  rotations[index] = GameObject::wrap_rotation(rotations[index] + angle);
+  moved[index] = 1U;
+}
+
+void EntityStore::store_previous_transforms() {
+  std::copy(positions.begin(), positions.end(), previous_positions.begin());
+  std::copy(rotations.begin(), rotations.end(), previous_rotations.begin());
+}
+
+void EntityStore::refresh_bounds() {
+  for (unsigned int i = 0U; i < types.size(); i++) {
+    if (!moved[i]) {
+      continue;
+    }
+    moved[i] = 0U;
+    if (VERTICES_FUNCTIONS[types[i]] != nullptr) {
+      VERTICES_FUNCTIONS[types[i]](*this, i);
+    }
+    bounds[i] = BOUNDS_FUNCTIONS[types[i]](*this, i);
+  }
+}
+
+// The destroyed flags go last, since every other component is swept by them.
+void EntityStore::compact(std::size_t first) {
+  unsigned int kept = static_cast<unsigned int>(first);
+  for (std::size_t i = first; i < handles.size(); i++) {
+    if (destroyed[i]) {
+      m_pools[types[i]].live--;
+      free_slot(handles[i]);
+    } else {
+      m_slots[handles[i].get_slot()].index = kept++;
+    }
+  }
+  compact_component(handles, destroyed, first);
+  compact_component(types, destroyed, first);
+  compact_component(positions, destroyed, first);
+  compact_component(velocities, destroyed, first);
+  compact_component(rotations, destroyed, first);
+  compact_component(radii, destroyed, first);
+  compact_component(bounds, destroyed, first);
+  compact_component(vertices, destroyed, first);
+  compact_component(moved, destroyed, first);
+  compact_component(ttls, destroyed, first);
+  compact_component(parent_types, destroyed, first);
+  compact_component(gun_cooldowns, destroyed, first);
+  compact_component(shooting, destroyed, first);
+  compact_component(aim_rotations, destroyed, first);
+  compact_component(aim_velocities, destroyed, first);
+  compact_component(origins, destroyed, first);
+  compact_component(previous_positions, destroyed, first);
+  compact_component(previous_rotations, destroyed, first);
+  compact_component(destroyed, destroyed, first);
+}
+
+void EntityStore::truncate(std::size_t count) {
+  for (std::size_t i = count; i < handles.size(); i++) {
+    m_pools[types[i]].live--;
+    free_slot(handles[i]);
+  }
+  handles.resize(count);
+  types.resize(count);
+  positions.resize(count);
+  velocities.resize(count);
+  rotations.resize(count);
+  radii.resize(count);
+  bounds.resize(count);
+  vertices.resize(count);
+  moved.resize(count);
+  destroyed.resize(count);
+  ttls.resize(count);
+  parent_types.resize(count);
+  gun_cooldowns.resize(count);
+  shooting.resize(count);
+  aim_rotations.resize(count);
+  aim_velocities.resize(count);
+  origins.resize(count);
+  previous_positions.resize(count);
+  previous_rotations.resize(count);
+}
+
+sf::Vector2f EntityStore::get_interpolated_position(unsigned int index,
+                                                    float alpha) const {
+  return previous_positions[index] +
+         (positions[index] - previous_positions[index]) * alpha;
+}
+
+// Turns the short way round, so 359 to 1 degree passes through 0.
+float EntityStore::get_interpolated_rotation(unsigned int index,
+                                             float alpha) const {
+  float turn = std::fmod(rotations[index] - previous_rotations[index] +
+                         540.0F, 360.0F) - 180.0F;
+  return previous_rotations[index] + turn * alpha;
+}
+
+const EntityStore::PoolStats &EntityStore::get_pool_stats(
+    GameObject::ObjectType type) const {
+  return m_pools[type];
+}
+
+// Growing by half again keeps the number of times the components are copied
+// logarithmic in the peak, as a vector's own doubling would.
+void EntityStore::grow_pool(GameObject::ObjectType type) {
+  unsigned int &capacity = m_pools[type].capacity;
+  unsigned int chunks = std::max(1U, (capacity / 2U + CHUNK_SIZE - 1U) /
+                                     CHUNK_SIZE);
+  capacity += chunks * CHUNK_SIZE;
+  std::size_t total = 0U;
+  for (const EntityStore::PoolStats &pool : m_pools) {
+    total += pool.capacity;
+  }
+  handles.reserve(total);
+  types.reserve(total);
+  positions.reserve(total);
+  velocities.reserve(total);
+  rotations.reserve(total);
+  radii.reserve(total);
+  bounds.reserve(total);
+  vertices.reserve(total);
+  moved.reserve(total);
+  destroyed.reserve(total);
+  ttls.reserve(total);
+  parent_types.reserve(total);
+  gun_cooldowns.reserve(total);
+  shooting.reserve(total);
+  aim_rotations.reserve(total);
+  aim_velocities.reserve(total);
+  origins.reserve(total);
+  previous_positions.reserve(total);
+  previous_rotations.reserve(total);
+  m_slots.reserve(total);
+  m_free_slots.reserve(total);
+}
+
+// A slot whose generation has run out is retired rather than reused, so that
+// no two objects ever share a handle.
+void EntityStore::free_slot(EntityHandle handle) {
+  Slot &slot = m_slots[handle.get_slot()];
+  slot.index = NOT_FOUND;
+  if (slot.generation < EntityHandle::MAX_GENERATION) {
+    slot.generation++;
+    m_free_slots.push_back(handle.get_slot());
+  }
+}
+
+}
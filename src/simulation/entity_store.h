@@ -0,0 +1,169 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_ENTITY_STORE_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_ENTITY_STORE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "game_object.h"
+
+namespace ag {
+
+// Names one object for as long as it lives: a slot in its store's handle
+// table in the low bits and, above them, the generation that slot was on
+// when the object was added. A slot is reused once its object is gone, with
+// its generation bumped, so a handle kept past its object's death finds
+// nothing rather than whatever took the slot over.
+struct EntityHandle {
+  static const unsigned int SLOT_BITS = 20U;
+  static const std::uint32_t SLOT_MASK = (1U << SLOT_BITS) - 1U;
+  static const std::uint32_t MAX_GENERATION = ~0U >> SLOT_BITS;
+
+  std::uint32_t value;
+
+  std::uint32_t get_slot() const { return value & SLOT_MASK; }
+  std::uint32_t get_generation() const { return value >> SLOT_BITS; }
+  bool operator ==(const EntityHandle &other) const {
+    return value == other.value;
+  }
+  bool operator !=(const EntityHandle &other) const {
+    return value != other.value;
+  }
+};
+
+// Everything needed to add one object, so that a spawn can be worked out in
+// one place and carried out later in another. Objects other than bullets
+// take a ttl of infinity and a parent type of NullType.
+struct ObjectSpawn {
+  GameObject::ObjectType type;
+  sf::Vector2f position;
+  float rotation;
+  sf::Vector2f velocity;
+  float radius;
+  sf::Vector2f origin;
+  float ttl;
+  GameObject::ObjectType parent_type;
+};
+
+// Every object in a game stored as structure of arrays: one packed array per
+// component, all indexed alike, so that a pass over a component walks memory
+// in order and compaction is a single sweep. The state the simulation reads
+// every tick comes first; the render state, which only front-ends read, is
+// kept apart from it. Type specific components hold a neutral value for
+// objects of other types.
+struct EntityStore {
+  // Points in the largest outline any polygon type has.
+  static const std::size_t MAX_VERTICES = 4U;
+
+  // Hot state.
+  std::vector<EntityHandle> handles;
+  std::vector<GameObject::ObjectType> types;
+  std::vector<sf::Vector2f> positions;
+  std::vector<sf::Vector2f> velocities;
+  std::vector<float> rotations;
+  std::vector<float> radii;
+  // Refreshed from the transform by refresh_bounds, together with the
+  // world-space outline of ships and saucers, so that every test against
+  // them in a tick reads vertices transformed once. Unused for circles.
+  std::vector<sf::FloatRect> bounds;
+  std::vector<std::array<sf::Vector2f, MAX_VERTICES>> vertices;
+  // Set whenever the transform changes, and cleared by refresh_bounds, which
+  // leaves objects that have not moved or turned as they were.
+  std::vector<std::uint8_t> moved;
+  std::vector<std::uint8_t> destroyed;
+  // Seconds a bullet has left, and the type of object that fired it;
+  // infinity and NullType for everything else.
+  std::vector<float> ttls;
+  std::vector<GameObject::ObjectType> parent_types;
+  // Saucers' guns: seconds until the next shot, whether one is ready, and
+  // the heading and velocity of that shot.
+  std::vector<float> gun_cooldowns;
+  std::vector<std::uint8_t> shooting;
+  std::vector<float> aim_rotations;
+  std::vector<sf::Vector2f> aim_velocities;
+  // Render state: the pivot in the local frame and the transform at the end
+  // of the previous tick, which drawing interpolates from.
+  std::vector<sf::Vector2f> origins;
+  std::vector<sf::Vector2f> previous_positions;
+  std::vector<float> previous_rotations;
+
+  // Returned by find for a handle whose object is gone, and by add when
+  // every slot is taken.
+  static const unsigned int NOT_FOUND = ~0U;
+  // Pools grow by whole chunks of this many objects.
+  static const unsigned int CHUNK_SIZE = 256U;
+
+  // The room the store keeps for one type of object: how many are in the
+  // store, how many fit before it has to grow, and the most there have been
+  // at once. Rows freed by compaction are reused by the next spawn, so once
+  // a pool has grown past a game's peak, spawning and despawning that type
+  // no longer touch the heap.
+  struct PoolStats {
+    unsigned int live;
+    unsigned int capacity;
+    unsigned int high_water;
+  };
+
+  std::size_t size() const;
+  // Appends an object that is not destroyed and has no type specific state,
+  // with its previous transform matching its current one, and returns its
+  // index. Its handle reuses the most recently freed slot, if there is one.
+  // At most 2^SLOT_BITS objects fit in the store at once, since a handle
+  // has no room for more slots; past that the spawn fails, adding nothing
+  // and returning NOT_FOUND. When the type's pool is full it grows by half
+  // again, in whole chunks, and every component reserves room for all the
+  // pools together.
+  unsigned int add(GameObject::ObjectType type, sf::Vector2f position,
+                   float rotation, sf::Vector2f velocity, float radius,
+                   sf::Vector2f origin);
+  unsigned int add(const ObjectSpawn &spawn);
+  // The object's index while it is in the store, even once flagged as
+  // destroyed, and NOT_FOUND after it has been compacted or truncated away.
+  unsigned int find(EntityHandle handle) const;
+  // Whether the object is in the store and not flagged as destroyed.
+  bool is_alive(EntityHandle handle) const;
+  // Teleports an object. The previous position moves along with it, so a
+  // wrap around the world edge does not interpolate across the screen.
+  // Both flag the object as moved.
+  void move_to(unsigned int index, sf::Vector2f position);
+  void rotate(unsigned int index, float angle);
+  // Records every current transform as the previous tick's; called before
+  // every tick.
+  void store_previous_transforms();
+  // Recomputes the bounds and outline of every object flagged as moved.
+  void refresh_bounds();
+  // Drops destroyed objects from index first onwards, keeping the rest in
+  // order, and frees their handles' slots.
+  void compact(std::size_t first);
+  void truncate(std::size_t count);
+  // The transform blended from the previous tick's towards the current one,
+  // with alpha running from 0 to 1.
+  sf::Vector2f get_interpolated_position(unsigned int index,
+                                         float alpha) const;
+  float get_interpolated_rotation(unsigned int index, float alpha) const;
+  const EntityStore::PoolStats &get_pool_stats(
+    GameObject::ObjectType type) const;
+
+ private:
+  // Where a slot's object sits in the component arrays, and the generation
+  // its current or next object's handle carries.
+  struct Slot {
+    unsigned int index;
+    std::uint32_t generation;
+  };
+
+  void grow_pool(GameObject::ObjectType type);
+  void free_slot(EntityHandle handle);
+
+  std::vector<EntityStore::Slot> m_slots;
+  std::vector<std::uint32_t> m_free_slots;
+  std::array<EntityStore::PoolStats, GameObject::NullType> m_pools{};
+};
+
+}
+
+#endif
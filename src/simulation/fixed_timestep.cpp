@@ -0,0 +1,39 @@
+#include "fixed_timestep.h"
+
+#include <cmath>
+
+namespace ag {
+
+FixedTimestep::FixedTimestep(float tick_rate, unsigned int max_steps)
+    : m_dt{1.0F / tick_rate}, m_max_steps{max_steps}, m_accumulator{0.0F} {}
+
+unsigned int FixedTimestep::advance(float elapsed) {
+  m_accumulator += elapsed;
+  unsigned int steps = 0U;
+  while (m_accumulator >= m_dt && steps < m_max_steps) {
+    m_accumulator -= m_dt;
+    steps++;
+  }
+  if (m_accumulator >= m_dt) {
+    m_accumulator = std::fmod(m_accumulator, m_dt);
+  }
+  return steps;
+}
+
+float FixedTimestep::get_dt() const {
+  return m_dt;
+}
+
+float FixedTimestep::get_alpha() const {
+  return m_accumulator / m_dt;
+}
+
+void FixedTimestep::set_tick_rate(float tick_rate) {
+  m_dt = 1.0F / tick_rate;
+}
+
+void FixedTimestep::set_max_steps(unsigned int max_steps) {
+  m_max_steps = max_steps;
+}
+
+}
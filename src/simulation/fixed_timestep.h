@@ -0,0 +1,31 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_FIXED_TIMESTEP_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_FIXED_TIMESTEP_H
+
+namespace ag {
+
+// Turns variable frame times into a whole number of fixed length ticks.
+// Leftover time carries over to the next frame, and no more than
+// max_steps ticks run per frame; once a frame falls further behind than
+// that, the backlog is dropped so slow frames cannot spiral.
+class FixedTimestep {
+ public:
+  explicit FixedTimestep(float tick_rate = 60.0F, unsigned int max_steps = 5U);
+  ~FixedTimestep() {};
+
+  // Adds a frame's elapsed seconds and returns how many ticks to run.
+  unsigned int advance(float elapsed);
+  float get_dt() const;
+  // How far the frame lies between the last tick and the next, from 0 to 1.
+  float get_alpha() const;
+  void set_tick_rate(float tick_rate);
+  void set_max_steps(unsigned int max_steps);
+
+ private:
+  float m_dt;
+  unsigned int m_max_steps;
+  float m_accumulator;
+};
+
+}
+
+#endif
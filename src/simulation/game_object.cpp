@@ -0,0 +1,31 @@
+#include "game_object.h"
+
+#include <array>
+#include <cmath>
+
+#include <SFML/System.hpp>
+
+namespace ag {
+
+float GameObject::wrap_rotation(float angle) {
+  float rotation = std::fmod(angle, 360.0F);
+  if (rotation < 0.0F) {
+    rotation += 360.0F;
+  }
+  return rotation;
+}
+
+sf::Vector2f GameObject::heading(float rotation) {
+  double r_sin = std::sin(rotation * (M_PI / 180.0F));
+  double r_cos = std::cos(rotation * (M_PI / 180.0F));
+  return sf::Vector2f{static_cast<float>(r_sin), static_cast<float>(-r_cos)};
+}
+
+sf::Vector2f GameObject::transform_point(sf::Vector2f position,
+                                         float rotation, sf::Vector2f origin,
+                                         sf::Vector2f point) {
+  return transform_polygon(position, rotation, origin,
+                           std::array<sf::Vector2f, 1U>{point}).vertices[0];
+}
+
+}
@@ -0,0 +1,60 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_GAME_OBJECT_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_GAME_OBJECT_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include <SFML/System.hpp>
+
+#include "polygon.h"
+
+namespace ag {
+
+// The kinds of object the simulation knows and the transform they share: a
+// position, and a rotation in degrees about an origin in the object's local
+// frame. The objects themselves live in an EntityStore.
+class GameObject {
+ public:
+  enum ObjectType {
+    PlayerType,
+    AsteroidType,
+    BulletType,
+    SaucerType,
+    NullType
+  };
+
+  // Keeps a rotation within [0, 360) like sf::Transformable does.
+  static float wrap_rotation(float angle);
+  // The unit vector an object rotated by this many degrees faces along.
+  static sf::Vector2f heading(float rotation);
+  // Maps points from an object's local frame, where the origin is the pivot,
+  // into the world.
+  static sf::Vector2f transform_point(sf::Vector2f position, float rotation,
+                                      sf::Vector2f origin, sf::Vector2f point);
+  template <std::size_t POINTS>
+  static Polygon<POINTS> transform_polygon(
+    sf::Vector2f position, float rotation, sf::Vector2f origin,
+    const std::array<sf::Vector2f, POINTS> &points);
+};
+
+template <std::size_t POINTS>
+Polygon<POINTS> GameObject::transform_polygon(
+    sf::Vector2f position, float rotation, sf::Vector2f origin,
+    const std::array<sf::Vector2f, POINTS> &points) {
+  float r_sin = std::sin(rotation * static_cast<float>(M_PI / 180.0));
+  float r_cos = std::cos(rotation * static_cast<float>(M_PI / 180.0));
+  Polygon<POINTS> polygon;
+  for (std::size_t i = 0U; i < POINTS; i++) {
+    sf::Vector2f local = points[i] - origin;
+    polygon.vertices[i] = sf::Vector2f{
+      position.x + local.x * r_cos - local.y * r_sin,
+      position.y + local.x * r_sin + local.y * r_cos
+    };
+  }
+  return polygon;
+}
+
+}
+
+#endif
@@ -0,0 +1,41 @@
+#include "input.h"
+
+#include <cstdint>
+
+#include "spaceship.h"
+
+namespace ag {
+
+std::uint8_t Input::get_buttons() const {
+  return m_buttons;
+}
+
+bool Input::is_pressed(Input::Button button) const {
+  return (m_buttons >> button) & 1U;
+}
+
+Spaceship::Controls Input::get_controls() const {
+  return Spaceship::Controls{
+    is_pressed(Input::ThrustButton),
+    is_pressed(Input::ReverseButton),
+    is_pressed(Input::TurnLeftButton),
+    is_pressed(Input::TurnRightButton),
+    is_pressed(Input::FireButton)
+  };
+}
+
+void Input::press(Input::Button button, bool pressed) {
+  if (pressed) {
+    m_buttons |= static_cast<std::uint8_t>(1U << button);
+  }
+}
+
+void Input::merge(const Input &other) {
+  m_buttons |= other.m_buttons;
+}
+
+void Input::clear() {
+  m_buttons = 0U;
+}
+
+}
@@ -0,0 +1,45 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_INPUT_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_INPUT_H
+
+#include <cstdint>
+
+#include "spaceship.h"
+
+namespace ag {
+
+// Everything the player asked of the simulation during one tick, packed one
+// bit per button so that sessions can be recorded and replayed. Ship buttons
+// are held; menu buttons are presses, so a front-end should report each one
+// for a single tick only.
+class Input {
+ public:
+  enum Button {
+    ThrustButton,
+    ReverseButton,
+    TurnLeftButton,
+    TurnRightButton,
+    FireButton,
+    ConfirmButton,
+    BackButton,
+    PauseButton,
+    ButtonCount
+  };
+
+  Input() : m_buttons{0U} {};
+  explicit Input(std::uint8_t buttons) : m_buttons{buttons} {};
+  ~Input() {};
+
+  std::uint8_t get_buttons() const;
+  bool is_pressed(Input::Button button) const;
+  Spaceship::Controls get_controls() const;
+  void press(Input::Button button, bool pressed = true);
+  void merge(const Input &other);
+  void clear();
+
+ private:
+  std::uint8_t m_buttons;
+};
+
+}
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_POLYGON_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_POLYGON_H
+
+#include <array>
+#include <cstddef>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "helpers.h"
+
+namespace ag {
+
+// A convex polygon in world space with its point count fixed at compile time.
+template <std::size_t POINTS>
+struct Polygon {
+  std::array<sf::Vector2f, POINTS> vertices;
+
+  void translate(sf::Vector2f offset) {
+    for (auto &&vertex : vertices) {
+      vertex += offset;
+    }
+  }
+};
+
+// The smallest box holding the polygon, grown by padding on every side.
+template <std::size_t POINTS>
+sf::FloatRect polygon_bounds(const Polygon<POINTS> &polygon, float padding) {
+  sf::Vector2f minimum = polygon.vertices[0];
+  sf::Vector2f maximum = polygon.vertices[0];
+  for (std::size_t i = 1U; i < POINTS; i++) {
+    minimum.x = polygon.vertices[i].x < minimum.x ? polygon.vertices[i].x
+                                                  : minimum.x;
+    minimum.y = polygon.vertices[i].y < minimum.y ? polygon.vertices[i].y
+                                                  : minimum.y;
+    maximum.x = polygon.vertices[i].x > maximum.x ? polygon.vertices[i].x
+                                                  : maximum.x;
+    maximum.y = polygon.vertices[i].y > maximum.y ? polygon.vertices[i].y
+                                                  : maximum.y;
+  }
+  return sf::FloatRect{minimum.x - padding, minimum.y - padding,
+                       maximum.x - minimum.x + 2.0F * padding,
+                       maximum.y - minimum.y + 2.0F * padding};
+}
+
+// The separating axis tests below project onto unnormalised edge normals.
+// Polygon against polygon only compares projections on the same axis, and
+// polygon against circle compares squared gaps with the squared radius
+// scaled by the axis length, so no axis is ever normalised.
+
+template <std::size_t POINTS>
+void project_polygon(const Polygon<POINTS> &polygon, sf::Vector2f axis,
+                     float &minimum, float &maximum) {
+  minimum = vector2f_dot_product(axis, polygon.vertices[0]);
+  maximum = minimum;
+  for (std::size_t i = 1U; i < POINTS; i++) {
+    float projection = vector2f_dot_product(axis, polygon.vertices[i]);
+    minimum = projection < minimum ? projection : minimum;
+    maximum = projection > maximum ? projection : maximum;
+  }
+}
+
+template <std::size_t POINTS>
+sf::Vector2f edge_normal(const Polygon<POINTS> &polygon, std::size_t edge) {
+  sf::Vector2f side = polygon.vertices[(edge + 1U) % POINTS] -
+                      polygon.vertices[edge];
+  return sf::Vector2f{-side.y, side.x};
+}
+
+template <std::size_t FIRST, std::size_t SECOND>
+bool polygons_separated(sf::Vector2f axis, const Polygon<FIRST> &first,
+                        const Polygon<SECOND> &second) {
+  float min_one, max_one, min_two, max_two;
+  project_polygon(first, axis, min_one, max_one);
+  project_polygon(second, axis, min_two, max_two);
+  return max_one < min_two || min_one > max_two;
+}
+
+template <std::size_t POINTS>
+bool polygon_circle_separated(sf::Vector2f axis,
+                              const Polygon<POINTS> &polygon,
+                              sf::Vector2f circle_position,
+                              float circle_radius) {
+  float minimum, maximum;
+  project_polygon(polygon, axis, minimum, maximum);
+  float center = vector2f_dot_product(axis, circle_position);
+  float reach = circle_radius * circle_radius *
+                vector2f_dot_product(axis, axis);
+  float gap = center - maximum;
+  if (gap > 0.0F && gap * gap > reach) {
+    return true;
+  }
+  gap = minimum - center;
+  return gap > 0.0F && gap * gap > reach;
+}
+
+template <std::size_t FIRST, std::size_t SECOND>
+bool polygons_overlap(const Polygon<FIRST> &first,
+                      const Polygon<SECOND> &second) {
+  for (std::size_t edge = 0U; edge < FIRST; edge++) {
+    if (polygons_separated(edge_normal(first, edge), first, second)) {
+      return false;
+    }
+  }
+  for (std::size_t edge = 0U; edge < SECOND; edge++) {
+    if (polygons_separated(edge_normal(second, edge), first, second)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <std::size_t POINTS>
+bool polygon_circle_overlap(const Polygon<POINTS> &polygon,
+                            sf::Vector2f circle_position,
+                            float circle_radius) {
+  sf::Vector2f circle_axis = polygon.vertices[0] - circle_position;
+  float closest = vector2f_dot_product(circle_axis, circle_axis);
+  for (std::size_t i = 1U; i < POINTS; i++) {
+    sf::Vector2f to_vertex = polygon.vertices[i] - circle_position;
+    float distance = vector2f_dot_product(to_vertex, to_vertex);
+    if (distance < closest) {
+      closest = distance;
+      circle_axis = to_vertex;
+    }
+  }
+  if (closest <= circle_radius * circle_radius) {
+    return true;
+  }
+  for (std::size_t edge = 0U; edge < POINTS; edge++) {
+    if (polygon_circle_separated(edge_normal(polygon, edge), polygon,
+                                 circle_position, circle_radius)) {
+      return false;
+    }
+  }
+  return !polygon_circle_separated(circle_axis, polygon, circle_position,
+                                   circle_radius);
+}
+
+}
+
+#endif
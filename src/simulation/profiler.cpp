@@ -0,0 +1,99 @@
+#include "profiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ag {
+
+namespace {
+
+struct Zone {
+  const char *name;
+  Profiler::Clock::time_point start;
+  Profiler::Clock::time_point end;
+};
+
+// Written only by its own thread. The count is published after each zone is
+// stored, so a reader that loads it sees every zone before it.
+struct ThreadBuffer {
+  explicit ThreadBuffer(unsigned int id)
+      : zones(Profiler::RING_SIZE), written{0U}, thread_id{id} {}
+
+  std::vector<Zone> zones;
+  std::atomic<std::uint64_t> written;
+  unsigned int thread_id;
+};
+
+// Buffers outlive their threads so that zones from finished threads still
+// export. The lock is only taken when a thread records its first zone and
+// while writing a trace.
+std::mutex registry_lock;
+std::vector<std::unique_ptr<ThreadBuffer>> registry;
+thread_local ThreadBuffer *thread_buffer = nullptr;
+const Profiler::Clock::time_point epoch = Profiler::Clock::now();
+
+ThreadBuffer &local_buffer() {
+  if (thread_buffer == nullptr) {
+    std::lock_guard<std::mutex> lock{registry_lock};
+    registry.emplace_back(
+      new ThreadBuffer{static_cast<unsigned int>(registry.size())});
+    thread_buffer = registry.back().get();
+  }
+  return *thread_buffer;
+}
+
+double microseconds(Profiler::Clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}
+
+std::atomic<bool> Profiler::s_enabled{false};
+
+void Profiler::set_enabled(bool enabled) {
+  s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::record(const char *name, Clock::time_point start,
+                      Clock::time_point end) {
+  if (!is_enabled()) {
+    return;
+  }
+  ThreadBuffer &buffer = local_buffer();
+  std::uint64_t written = buffer.written.load(std::memory_order_relaxed);
+  buffer.zones[written % RING_SIZE] = Zone{name, start, end};
+  buffer.written.store(written + 1U, std::memory_order_release);
+}
+
+bool Profiler::write_chrome_trace(const std::string &path) {
+  std::FILE *file = std::fopen(path.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+  std::fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+  const char *separator = "";
+  std::lock_guard<std::mutex> lock{registry_lock};
+  for (auto &&buffer : registry) {
+    std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+    std::uint64_t first = written > RING_SIZE ? written - RING_SIZE : 0U;
+    for (std::uint64_t i = first; i < written; i++) {
+      const Zone &zone = buffer->zones[i % RING_SIZE];
+      std::fprintf(file, "%s{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, "
+                   "\"tid\": %u, \"ts\": %.3f, \"dur\": %.3f}", separator,
+                   zone.name, buffer->thread_id,
+                   microseconds(zone.start - epoch),
+                   microseconds(zone.end - zone.start));
+      separator = ",\n";
+    }
+  }
+  std::fprintf(file, "\n]}\n");
+  return std::fclose(file) == 0;
+}
+
+}
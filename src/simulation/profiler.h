@@ -0,0 +1,75 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_PROFILER_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include "allocation_tracker.h"
+
+namespace ag {
+
+// Collects timed zones from every thread for export as a Chrome trace_event
+// file, which chrome://tracing and Perfetto open. Each thread writes into its
+// own fixed-size ring buffer without locking, keeping the latest
+// RING_SIZE zones. While it and the allocation tracker are both off, a zone
+// costs two relaxed atomic loads.
+class Profiler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static const unsigned int RING_SIZE = 1U << 17U;
+
+  static bool is_enabled() {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
+  static void set_enabled(bool enabled);
+  // Adds a zone named by a string that outlives the profiler, usually a
+  // literal, to the calling thread's buffer. Does nothing while disabled.
+  static void record(const char *name, Clock::time_point start,
+                     Clock::time_point end);
+  // Writes every buffered zone. Zones recorded while this runs may be
+  // missed or cut short, so call it between frames or once threads are done.
+  static bool write_chrome_trace(const std::string &path);
+
+ private:
+  static std::atomic<bool> s_enabled;
+};
+
+// Times the scope it lives in as one zone. Zones on a thread nest by time,
+// so a zone opened inside another shows up beneath it in the trace. While
+// the allocation tracker is on, allocations in the scope are charged to it.
+class ProfileZone {
+ public:
+  explicit ProfileZone(const char *name)
+      : m_name{name}, m_enabled{Profiler::is_enabled()},
+        m_tracked{AllocationTracker::is_enabled()}, m_outer{nullptr} {
+    if (m_tracked) {
+      m_outer = AllocationTracker::enter_zone(name);
+    }
+    if (m_enabled) {
+      m_start = Profiler::Clock::now();
+    }
+  }
+  ~ProfileZone() {
+    if (m_enabled) {
+      Profiler::record(m_name, m_start, Profiler::Clock::now());
+    }
+    if (m_tracked) {
+      AllocationTracker::leave_zone(m_outer);
+    }
+  }
+  ProfileZone(const ProfileZone &) = delete;
+  ProfileZone &operator=(const ProfileZone &) = delete;
+
+ private:
+  const char *m_name;
+  bool m_enabled;
+  bool m_tracked;
+  const char *m_outer;
+  Profiler::Clock::time_point m_start;
+};
+
+}
+
+#endif
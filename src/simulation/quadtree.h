@@ -0,0 +1,461 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_QUADTREE_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_QUADTREE_H
+
+#include <array>
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "broadphase.h"
+
+namespace ag {
+
+// Linear quadtree stored in one node array. Each node is identified by its
+// level and the Morton code of its cell at that level, and its four children
+// sit next to each other in the array in Morton order (top left, top right,
+// bottom left, bottom right). A node keeps its cell, halved from its
+// parent's when it is made, so walks never rebuild it from the code. Nodes
+// and objects come from arenas with free lists, so nothing is allocated once
+// they have grown to the size of a typical frame.
+//
+// The tree is maintained incrementally. Inserting an object that is already
+// in the tree moves it: nothing happens while it stays inside its node,
+// otherwise it climbs to the nearest ancestor that still holds it and
+// descends from there. A node splits once it holds more than MAX_OBJECTS
+// objects and its children merge back only when the node and its children
+// hold MAX_OBJECTS / 2 or fewer, so a node near the limit does not split
+// and merge every frame. Objects stay in the tree until they are removed.
+//
+// With a looseness above 1 the tree is loose: every node's bounds are grown
+// by that factor around its cell, an object descends into the child that
+// holds its center for as long as it fits inside that child's loose bounds,
+// and queries visit the nodes whose loose bounds they overlap. Objects that
+// cross a midpoint then sink as deep as their size allows instead of
+// collecting near the root.
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+class QuadTree : public Broadphase {
+ public:
+  explicit QuadTree(sf::FloatRect world_area, float looseness = 1.0F);
+  ~QuadTree() {};
+
+  void clear() override;
+  void insert(unsigned int index, unsigned int id,
+              sf::FloatRect bounds, Filter filter) override;
+  void remove(unsigned int id) override;
+  void retrieve(unsigned int index, sf::FloatRect bounds, Filter filter,
+                std::vector<Candidate> &candidates) const override;
+  void retrieve_area(sf::FloatRect bounds, Filter filter,
+                     std::vector<Candidate> &candidates) const override;
+  template <typename Visitor>
+  void query(sf::FloatRect bounds, Visitor &&visit,
+             Filter filter = Filter{~0U, ~0U}) const;
+  unsigned int get_node_count() const;
+
+ private:
+  struct Node {
+    unsigned int code;
+    unsigned int level;
+    sf::FloatRect cell;
+    int parent;
+    int first_child;
+    int first_item;
+    unsigned int item_count;
+  };
+
+  struct Item {
+    unsigned int index;
+    unsigned int id;
+    sf::FloatRect bounds;
+    Filter filter;
+    int node;
+    int previous;
+    int next;
+  };
+
+  static sf::FloatRect child_cell(sf::FloatRect cell, unsigned int quadrant);
+  sf::FloatRect loose_bounds(sf::FloatRect cell) const;
+  sf::Vector2f node_midpoint(const Node &node) const;
+  int get_index(const Node &node, sf::FloatRect bound_box) const;
+  int get_loose_index(const Node &node, sf::FloatRect bound_box) const;
+  bool fits(const Node &node, sf::FloatRect bound_box) const;
+  bool belongs(const Node &node, sf::FloatRect bound_box) const;
+  void place(int node, int item);
+  void link(int node, int item);
+  void unlink(int item);
+  void split(int node);
+  bool merge(int node);
+  void merge_upwards(int node);
+
+  sf::FloatRect m_world_area;
+  float m_looseness;
+  std::vector<Node> m_nodes;
+  std::vector<int> m_free_blocks;
+  std::vector<Item> m_items;
+  int m_free_item;
+  std::vector<int> m_item_of_id;
+};
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+QuadTree<MAX_OBJECTS, MAX_LEVELS>::QuadTree(sf::FloatRect world_area,
+                                            float looseness)
+    : m_world_area{world_area}, m_looseness{looseness}, m_free_item{-1} {
+  m_nodes.push_back(Node{0U, 0U, world_area, -1, -1, -1, 0U});
+}
+
+// The tree keeps its objects between frames; they leave it through remove.
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::clear() {}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::insert(unsigned int index,
+                                               unsigned int id,
+                                               sf::FloatRect bounds,
+                                               Filter filter) {
+  if (id >= m_item_of_id.size()) {
+    m_item_of_id.resize(id + 1U, -1);
+  }
+  int item = m_item_of_id[id];
+  if (item == -1) {
+    if (m_free_item != -1) {
+      item = m_free_item;
+      m_free_item = m_items[item].next;
+    } else {
+      item = static_cast<int>(m_items.size());
+      m_items.push_back(Item{});
+    }
+    m_items[item] = Item{index, id, bounds, filter, -1, -1, -1};
+    m_item_of_id[id] = item;
+    place(0, item);
+    return;
+  }
+  m_items[item].index = index;
+  m_items[item].bounds = bounds;
+  m_items[item].filter = filter;
+  int node = m_items[item].node;
+  if (belongs(m_nodes[node], bounds)) {
+    return;
+  }
+  unlink(item);
+  int ancestor = node;
+  while (!fits(m_nodes[ancestor], bounds)) {
+    ancestor = m_nodes[ancestor].parent;
+  }
+  place(ancestor, item);
+  merge_upwards(node);
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::remove(unsigned int id) {
+  if (id >= m_item_of_id.size() || m_item_of_id[id] == -1) {
+    return;
+  }
+  int item = m_item_of_id[id];
+  int node = m_items[item].node;
+  unlink(item);
+  m_items[item].next = m_free_item;
+  m_free_item = item;
+  m_item_of_id[id] = -1;
+  merge_upwards(node);
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::retrieve(unsigned int index,
+    sf::FloatRect bounds, Filter filter,
+    std::vector<Candidate> &candidates) const {
+  retrieve_area(bounds, filter, candidates);
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::retrieve_area(sf::FloatRect bounds,
+    Filter filter, std::vector<Candidate> &candidates) const {
+  query(bounds, [&candidates](unsigned int other_index) {
+    candidates.push_back(Candidate{other_index});
+  }, filter);
+}
+
+// Calls visit with the index of every object stored in a node that the bounds
+// reach and whose filter the given filter accepts. The walk uses a fixed size
+// stack, so it never allocates.
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+template <typename Visitor>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::query(sf::FloatRect bounds,
+                                              Visitor &&visit,
+                                              Filter filter) const {
+  std::array<unsigned int, 3U * MAX_LEVELS + 1U> stack;
+  unsigned int stack_size = 0U;
+  stack[stack_size++] = 0U;
+  while (stack_size > 0U) {
+    const Node &node = m_nodes[stack[--stack_size]];
+    for (int item = node.first_item; item != -1; item = m_items[item].next) {
+      if (filter.accepts(m_items[item].filter)) {
+        visit(m_items[item].index);
+      }
+    }
+    if (node.first_child == -1) {
+      continue;
+    }
+    unsigned int first_child = static_cast<unsigned int>(node.first_child);
+    if (m_looseness > 1.0F) {
+      for (unsigned int quadrant = 0U; quadrant < 4U; quadrant++) {
+        if (bounds.intersects(
+              loose_bounds(m_nodes[first_child + quadrant].cell))) {
+          stack[stack_size++] = first_child + quadrant;
+        }
+      }
+      continue;
+    }
+    sf::Vector2f midpoint = node_midpoint(node);
+    bool left = bounds.left < midpoint.x;
+    bool right = bounds.left + bounds.width > midpoint.x;
+    bool top = bounds.top < midpoint.y;
+    bool bottom = bounds.top + bounds.height > midpoint.y;
+    if (top && left) {
+      stack[stack_size++] = first_child;
+    }
+    if (top && right) {
+      stack[stack_size++] = first_child + 1U;
+    }
+    if (bottom && left) {
+      stack[stack_size++] = first_child + 2U;
+    }
+    if (bottom && right) {
+      stack[stack_size++] = first_child + 3U;
+    }
+  }
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+unsigned int QuadTree<MAX_OBJECTS, MAX_LEVELS>::get_node_count() const {
+  return static_cast<unsigned int>(m_nodes.size() - 4U * m_free_blocks.size());
+}
+
+// One quarter of a cell, in Morton order. The world's sides halve exactly
+// at every level the tree reaches, so this matches the cell worked out
+// from the code.
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+sf::FloatRect QuadTree<MAX_OBJECTS, MAX_LEVELS>::child_cell(
+    sf::FloatRect cell, unsigned int quadrant) {
+  sf::Vector2f half{cell.width / 2.0F, cell.height / 2.0F};
+  return sf::FloatRect{cell.left + ((quadrant & 1U) != 0U ? half.x : 0.0F),
+                       cell.top + ((quadrant & 2U) != 0U ? half.y : 0.0F),
+                       half.x, half.y};
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+sf::FloatRect QuadTree<MAX_OBJECTS, MAX_LEVELS>::loose_bounds(
+    sf::FloatRect cell) const {
+  float margin_x = cell.width * (m_looseness - 1.0F) / 2.0F;
+  float margin_y = cell.height * (m_looseness - 1.0F) / 2.0F;
+  return sf::FloatRect{cell.left - margin_x, cell.top - margin_y,
+                       cell.width + 2.0F * margin_x,
+                       cell.height + 2.0F * margin_y};
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+sf::Vector2f QuadTree<MAX_OBJECTS, MAX_LEVELS>::node_midpoint(
+    const Node &node) const {
+  return sf::Vector2f{node.cell.left + node.cell.width / 2.0F,
+                      node.cell.top + node.cell.height / 2.0F};
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+int QuadTree<MAX_OBJECTS, MAX_LEVELS>::get_index(const Node &node,
+    sf::FloatRect bound_box) const {
+  if (m_looseness > 1.0F) {
+    return get_loose_index(node, bound_box);
+  }
+  int index = -1;
+  sf::Vector2f midpoint = node_midpoint(node);
+  bool top_half = (bound_box.top < midpoint.y &&
+                   bound_box.top + bound_box.height < midpoint.y);
+  bool bottom_half = (bound_box.top > midpoint.y);
+  if (bound_box.left < midpoint.x &&
+      bound_box.left + bound_box.width < midpoint.x) {
+    if (top_half) {
+      index = 0;
+    } else if (bottom_half) {
+      index = 2;
+    }
+  } else if (bound_box.left > midpoint.x) {
+    if (top_half) {
+      index = 1;
+    } else if (bottom_half) {
+      index = 3;
+    }
+  }
+  return index;
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+int QuadTree<MAX_OBJECTS, MAX_LEVELS>::get_loose_index(const Node &node,
+    sf::FloatRect bound_box) const {
+  sf::Vector2f midpoint = node_midpoint(node);
+  int index = 0;
+  if (bound_box.left + bound_box.width / 2.0F > midpoint.x) {
+    index |= 1;
+  }
+  if (bound_box.top + bound_box.height / 2.0F > midpoint.y) {
+    index |= 2;
+  }
+  sf::FloatRect child = loose_bounds(
+    m_nodes[node.first_child + index].cell);
+  if (bound_box.left < child.left || bound_box.top < child.top ||
+      bound_box.left + bound_box.width > child.left + child.width ||
+      bound_box.top + bound_box.height > child.top + child.height) {
+    return -1;
+  }
+  return index;
+}
+
+// Whether the bounds lie inside the region the node is responsible for. In a
+// tight tree that is the node's cell, open towards the edges of the world
+// like get_index; in a loose tree it is the node's loose bounds.
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+bool QuadTree<MAX_OBJECTS, MAX_LEVELS>::fits(const Node &node,
+                                             sf::FloatRect bound_box) const {
+  if (node.parent == -1) {
+    return true;
+  }
+  if (m_looseness > 1.0F) {
+    sf::FloatRect loose = loose_bounds(node.cell);
+    return bound_box.left >= loose.left && bound_box.top >= loose.top &&
+           bound_box.left + bound_box.width <= loose.left + loose.width &&
+           bound_box.top + bound_box.height <= loose.top + loose.height;
+  }
+  const sf::FloatRect &cell = node.cell;
+  float cell_right = cell.left + cell.width;
+  float cell_bottom = cell.top + cell.height;
+  return (cell.left <= m_world_area.left || bound_box.left > cell.left) &&
+         (cell.top <= m_world_area.top || bound_box.top > cell.top) &&
+         (cell_right >= m_world_area.left + m_world_area.width ||
+          bound_box.left + bound_box.width < cell_right) &&
+         (cell_bottom >= m_world_area.top + m_world_area.height ||
+          bound_box.top + bound_box.height < cell_bottom);
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+bool QuadTree<MAX_OBJECTS, MAX_LEVELS>::belongs(const Node &node,
+    sf::FloatRect bound_box) const {
+  return fits(node, bound_box) &&
+         (node.first_child == -1 || get_index(node, bound_box) == -1);
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::place(int node, int item) {
+  while (m_nodes[node].first_child != -1) {
+    int quadrant = get_index(m_nodes[node], m_items[item].bounds);
+    if (quadrant == -1) {
+      break;
+    }
+    node = m_nodes[node].first_child + quadrant;
+  }
+  link(node, item);
+  if (m_nodes[node].item_count > MAX_OBJECTS &&
+      m_nodes[node].level < MAX_LEVELS && m_nodes[node].first_child == -1) {
+    split(node);
+  }
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::link(int node, int item) {
+  Item &linked = m_items[item];
+  linked.node = node;
+  linked.previous = -1;
+  linked.next = m_nodes[node].first_item;
+  if (linked.next != -1) {
+    m_items[linked.next].previous = item;
+  }
+  m_nodes[node].first_item = item;
+  m_nodes[node].item_count++;
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::unlink(int item) {
+  Item &unlinked = m_items[item];
+  Node &node = m_nodes[unlinked.node];
+  if (unlinked.previous != -1) {
+    m_items[unlinked.previous].next = unlinked.next;
+  } else {
+    node.first_item = unlinked.next;
+  }
+  if (unlinked.next != -1) {
+    m_items[unlinked.next].previous = unlinked.previous;
+  }
+  node.item_count--;
+  unlinked.node = -1;
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::split(int node) {
+  int first_child;
+  if (!m_free_blocks.empty()) {
+    first_child = m_free_blocks.back();
+    m_free_blocks.pop_back();
+  } else {
+    first_child = static_cast<int>(m_nodes.size());
+    m_nodes.resize(m_nodes.size() + 4U);
+  }
+  for (unsigned int quadrant = 0U; quadrant < 4U; quadrant++) {
+    m_nodes[first_child + quadrant] = Node{
+      (m_nodes[node].code << 2U) | quadrant, m_nodes[node].level + 1U,
+      child_cell(m_nodes[node].cell, quadrant), node, -1, -1, 0U
+    };
+  }
+  m_nodes[node].first_child = first_child;
+  int item = m_nodes[node].first_item;
+  while (item != -1) {
+    int next = m_items[item].next;
+    int quadrant = get_index(m_nodes[node], m_items[item].bounds);
+    if (quadrant != -1) {
+      unlink(item);
+      link(first_child + quadrant, item);
+    }
+    item = next;
+  }
+  for (int child = first_child; child < first_child + 4; child++) {
+    if (m_nodes[child].item_count > MAX_OBJECTS &&
+        m_nodes[child].level < MAX_LEVELS) {
+      split(child);
+    }
+  }
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+bool QuadTree<MAX_OBJECTS, MAX_LEVELS>::merge(int node) {
+  int first_child = m_nodes[node].first_child;
+  unsigned int total = m_nodes[node].item_count;
+  for (int child = first_child; child < first_child + 4; child++) {
+    if (m_nodes[child].first_child != -1) {
+      return false;
+    }
+    total += m_nodes[child].item_count;
+  }
+  if (total > MAX_OBJECTS / 2U) {
+    return false;
+  }
+  for (int child = first_child; child < first_child + 4; child++) {
+    while (m_nodes[child].first_item != -1) {
+      int item = m_nodes[child].first_item;
+      unlink(item);
+      link(node, item);
+    }
+  }
+  m_nodes[node].first_child = -1;
+  m_free_blocks.push_back(first_child);
+  return true;
+}
+
+template <unsigned int MAX_OBJECTS, unsigned int MAX_LEVELS>
+void QuadTree<MAX_OBJECTS, MAX_LEVELS>::merge_upwards(int node) {
+  while (node != -1) {
+    if (m_nodes[node].first_child != -1 && !merge(node)) {
+      return;
+    }
+    node = m_nodes[node].parent;
+  }
+}
+
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include "random.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ag {
+
+namespace {
+
+std::uint64_t rotate_left(std::uint64_t value, int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+// Spreads a seed across the state so that similar seeds such as 1 and 2
+// still start far apart; also guarantees the state is never all zero.
+std::uint64_t split_mix(std::uint64_t &value) {
+  std::uint64_t result = (value += 0x9E3779B97F4A7C15U);
+  result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9U;
+  result = (result ^ (result >> 27)) * 0x94D049BB133111EBU;
+  return result ^ (result >> 31);
+}
+
+}
+
+Random::Random(std::uint64_t seed, unsigned int stream) {
+  this->seed(seed, stream);
+}
+
+void Random::seed(std::uint64_t seed, unsigned int stream) {
+  m_seed = seed;
+  for (auto &&word : m_state) {
+    word = split_mix(seed);
+  }
+  for (unsigned int i = 0U; i < stream; i++) {
+    jump();
+  }
+}
+
+std::uint64_t Random::get_seed() const {
+  return m_seed;
+}
+
+Random::result_type Random::operator()() {
+  std::uint64_t result = rotate_left(m_state[1] * 5U, 7) * 9U;
+  std::uint64_t shifted = m_state[1] << 17;
+  m_state[2] ^= m_state[0];
+  m_state[3] ^= m_state[1];
+  m_state[1] ^= m_state[2];
+  m_state[0] ^= m_state[3];
+  m_state[2] ^= shifted;
+  m_state[3] = rotate_left(m_state[3], 45);
+  return result;
+}
+
+// Multiplies instead of taking a remainder, which avoids a division and the
+// low-bit bias of rand() % bound.
+std::uint32_t Random::next_below(std::uint32_t bound) {
+  return static_cast<std::uint32_t>(((*this)() >> 32) * bound >> 32);
+}
+
+float Random::next_float(float low, float high) {
+  float unit = static_cast<float>((*this)() >> 40) * (1.0F / 16777216.0F);
+  return low + (high - low) * unit;
+}
+
+// Advances the stream by 2^128 draws.
+void Random::jump() {
+  const std::array<std::uint64_t, 4U> JUMP{
+    0x180EC6D33CFD0ABAU, 0xD5A61266F0C9392CU,
+    0xA9582618E03FC9AAU, 0x39ABDC4529B1661CU
+  };
+  std::array<std::uint64_t, 4U> jumped{0U, 0U, 0U, 0U};
+  for (auto &&word : JUMP) {
+    for (int bit = 0; bit < 64; bit++) {
+      if (word & (std::uint64_t{1U} << bit)) {
+        for (std::size_t i = 0U; i < jumped.size(); i++) {
+          jumped[i] ^= m_state[i];
+        }
+      }
+      (*this)();
+    }
+  }
+  m_state = jumped;
+}
+
+}
@@ -0,0 +1,46 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_RANDOM_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_RANDOM_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace ag {
+
+// A xoshiro256** random number stream. Each simulation owns one, so runs
+// with the same seed play out identically and simulations on different
+// threads share no hidden state. Streams with the same seed but different
+// stream numbers are 2^128 draws apart and never overlap in practice.
+// Meets the standard UniformRandomBitGenerator requirements.
+class Random {
+ public:
+  using result_type = std::uint64_t;
+
+  explicit Random(std::uint64_t seed = 0U, unsigned int stream = 0U);
+  ~Random() {};
+
+  static constexpr result_type min() {
+    return 0U;
+  }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  void seed(std::uint64_t seed, unsigned int stream = 0U);
+  std::uint64_t get_seed() const;
+  result_type operator()();
+  // A whole number in [0, bound).
+  std::uint32_t next_below(std::uint32_t bound);
+  // A float in [low, high).
+  float next_float(float low, float high);
+
+ private:
+  void jump();
+
+  std::array<std::uint64_t, 4U> m_state;
+  std::uint64_t m_seed;
+};
+
+}
+
+#endif
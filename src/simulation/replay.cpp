@@ -0,0 +1,157 @@
+#include "replay.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "input.h"
+
+namespace ag {
+
+namespace {
+
+const char MAGIC[4] = {'A', 'G', 'R', 'P'};
+const std::uint8_t VERSION = 1U;
+
+void write_integer(std::vector<std::uint8_t> &bytes, std::uint64_t value,
+                   unsigned int size) {
+  for (unsigned int i = 0U; i < size; i++) {
+    bytes.push_back(static_cast<std::uint8_t>(value >> (8U * i)));
+  }
+}
+
+bool read_integer(const std::vector<std::uint8_t> &bytes, std::size_t &offset,
+                  std::uint64_t &value, unsigned int size) {
+  if (bytes.size() - offset < size) {
+    return false;
+  }
+  value = 0U;
+  for (unsigned int i = 0U; i < size; i++) {
+    value |= static_cast<std::uint64_t>(bytes[offset++]) << (8U * i);
+  }
+  return true;
+}
+
+void write_run_length(std::vector<std::uint8_t> &bytes, std::uint64_t value) {
+  while (value >= 0x80U) {
+    bytes.push_back(static_cast<std::uint8_t>(value | 0x80U));
+    value >>= 7U;
+  }
+  bytes.push_back(static_cast<std::uint8_t>(value));
+}
+
+bool read_run_length(const std::vector<std::uint8_t> &bytes,
+                     std::size_t &offset, std::uint64_t &value) {
+  value = 0U;
+  for (unsigned int shift = 0U; shift < 64U; shift += 7U) {
+    if (offset == bytes.size()) {
+      return false;
+    }
+    std::uint8_t byte = bytes[offset++];
+    value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+    if (!(byte & 0x80U)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}
+
+Replay::Replay(std::uint64_t seed, float tick_rate)
+    : m_seed{seed}, m_tick_rate{tick_rate}, m_cursor{0U} {}
+
+bool Replay::load(const std::string &path) {
+  std::ifstream file{path, std::ios::binary};
+  if (!file) {
+    return false;
+  }
+  std::vector<std::uint8_t> bytes{std::istreambuf_iterator<char>{file},
+                                  std::istreambuf_iterator<char>{}};
+  std::size_t offset = sizeof(MAGIC) + 1U;
+  if (bytes.size() < offset ||
+      std::memcmp(bytes.data(), MAGIC, sizeof(MAGIC)) != 0 ||
+      bytes[sizeof(MAGIC)] != VERSION) {
+    return false;
+  }
+  std::uint64_t seed, tick_rate_bits, tick_count, buttons, run;
+  if (!read_integer(bytes, offset, seed, 8U) ||
+      !read_integer(bytes, offset, tick_rate_bits, 4U) ||
+      !read_integer(bytes, offset, tick_count, 4U)) {
+    return false;
+  }
+  std::vector<std::uint8_t> ticks;
+  while (ticks.size() < tick_count) {
+    if (!read_integer(bytes, offset, buttons, 1U) ||
+        !read_run_length(bytes, offset, run) ||
+        run > tick_count - ticks.size()) {
+      return false;
+    }
+    ticks.insert(ticks.end(), run, static_cast<std::uint8_t>(buttons));
+  }
+  std::uint32_t tick_rate_word = static_cast<std::uint32_t>(tick_rate_bits);
+  std::memcpy(&m_tick_rate, &tick_rate_word, sizeof(m_tick_rate));
+  m_seed = seed;
+  m_ticks.swap(ticks);
+  m_cursor = 0U;
+  return true;
+}
+
+bool Replay::save(const std::string &path) const {
+  std::vector<std::uint8_t> bytes{std::begin(MAGIC), std::end(MAGIC)};
+  bytes.push_back(VERSION);
+  std::uint32_t tick_rate_word;
+  std::memcpy(&tick_rate_word, &m_tick_rate, sizeof(tick_rate_word));
+  write_integer(bytes, m_seed, 8U);
+  write_integer(bytes, tick_rate_word, 4U);
+  write_integer(bytes, m_ticks.size(), 4U);
+  for (std::size_t start = 0U, end = 0U; start < m_ticks.size();
+       start = end) {
+    while (end < m_ticks.size() && m_ticks[end] == m_ticks[start]) {
+      end++;
+    }
+    bytes.push_back(m_ticks[start]);
+    write_run_length(bytes, end - start);
+  }
+  std::ofstream file{path, std::ios::binary};
+  file.write(reinterpret_cast<const char *>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+  return static_cast<bool>(file);
+}
+
+std::uint64_t Replay::get_seed() const {
+  return m_seed;
+}
+
+float Replay::get_tick_rate() const {
+  return m_tick_rate;
+}
+
+std::size_t Replay::get_tick_count() const {
+  return m_ticks.size();
+}
+
+void Replay::record(const Input &input) {
+  m_ticks.push_back(input.get_buttons());
+}
+
+bool Replay::finished() const {
+  return m_cursor >= m_ticks.size();
+}
+
+Input Replay::next() {
+  if (finished()) {
+    return Input{};
+  }
+  return Input{m_ticks[m_cursor++]};
+}
+
+void Replay::rewind() {
+  m_cursor = 0U;
+}
+
+}
@@ -0,0 +1,47 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_REPLAY_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_REPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "input.h"
+
+namespace ag {
+
+// A recorded session: the seed and tick rate it ran at and every tick's
+// input. Feeding the inputs back, one per tick, into a simulation built with
+// the same seed plays the session out exactly as it went.
+//
+// Files start with the magic "AGRP", a version byte, the seed, the tick rate
+// and the tick count, all little-endian; then the inputs as runs of a button
+// byte followed by the run length in 7-bit groups, since held buttons
+// change far less often than every tick.
+class Replay {
+ public:
+  Replay() : m_seed{0U}, m_tick_rate{60.0F}, m_cursor{0U} {};
+  explicit Replay(std::uint64_t seed, float tick_rate);
+  ~Replay() {};
+
+  bool load(const std::string &path);
+  bool save(const std::string &path) const;
+  std::uint64_t get_seed() const;
+  float get_tick_rate() const;
+  std::size_t get_tick_count() const;
+  void record(const Input &input);
+  bool finished() const;
+  // The next tick's input during playback.
+  Input next();
+  void rewind();
+
+ private:
+  std::uint64_t m_seed;
+  float m_tick_rate;
+  std::vector<std::uint8_t> m_ticks;
+  std::size_t m_cursor;
+};
+
+}
+
+#endif
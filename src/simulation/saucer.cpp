@@ -0,0 +1,108 @@
+#include "saucer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "bullet.h"
+#include "command_buffer.h"
+#include "entity_store.h"
+#include "game_object.h"
+#include "helpers.h"
+#include "polygon.h"
+
+namespace ag {
+
+namespace {
+
+const float SAUCER_SPEED = 100.0F;
+const float SAUCER_RADIUS = 40.0F;
+const float GUN_COOLDOWN = 1.0F;
+const float BULLET_LIFETIME = 4.0F;
+const float OUTLINE_THICKNESS = 1.0F;
+const sf::Vector2f SAUCER_ORIGIN{20.0F, 40.0F};
+const std::array<sf::Vector2f, Saucer::POINT_COUNT> SHAPE{
+  sf::Vector2f{0.0F, 40.0F}, sf::Vector2f{20.0F, 0.0F},
+  sf::Vector2f{40.0F, 40.0F}, sf::Vector2f{20.0F, 80.0F}
+};
+
+}
+
+ObjectSpawn Saucer::make(sf::Vector2f starting_pos, float rotation) {
+  float heading_rotation = GameObject::wrap_rotation(-90.0F + rotation);
+  return ObjectSpawn{
+    GameObject::SaucerType, starting_pos, heading_rotation,
+    GameObject::heading(heading_rotation) * SAUCER_SPEED, SAUCER_RADIUS,
+    SAUCER_ORIGIN, std::numeric_limits<float>::infinity(),
+    GameObject::NullType
+  };
+}
+
+unsigned int Saucer::spawn(EntityStore &store, sf::Vector2f starting_pos,
+                           float rotation) {
+  return store.add(make(starting_pos, rotation));
+}
+
+void Saucer::update(EntityStore &store, unsigned int index, float dt) {
+  if (store.gun_cooldowns[index] <= 0.0F) {
+    store.shooting[index] = 1U;
+  } else {
+    store.gun_cooldowns[index] -= dt;
+  }
+}
+
+void Saucer::aim(EntityStore &store, unsigned int index,
+                 sf::Vector2f player_position) {
+  sf::Vector2f distance_v{player_position.x - store.positions[index].x,
+                          player_position.y - store.positions[index].y};
+  float trajectory_a = std::atan2(distance_v.y, distance_v.x) *
+                       (180.0F / M_PI);
+  store.aim_rotations[index] = trajectory_a + 90.0F;
+  store.aim_velocities[index] = normalize_vector2f(distance_v);
+}
+
+void Saucer::spawn_child(EntityStore &store, unsigned int index,
+                         CommandBuffer &commands) {
+  store.shooting[index] = 0U;
+  store.gun_cooldowns[index] = GUN_COOLDOWN;
+  sf::Vector2f gun_position = GameObject::transform_point(
+    store.positions[index], store.rotations[index], SAUCER_ORIGIN,
+    SHAPE[0] - sf::Vector2f{3.0F, 0.0F});
+  commands.spawn(Bullet::make(GameObject::SaucerType,
+                              store.aim_rotations[index],
+                              store.aim_velocities[index], gun_position,
+                              BULLET_LIFETIME));
+}
+
+static_assert(Saucer::POINT_COUNT <= EntityStore::MAX_VERTICES,
+              "the store has no room for the outline");
+
+void Saucer::refresh_vertices(EntityStore &store, unsigned int index) {
+  Polygon<POINT_COUNT> polygon = GameObject::transform_polygon(
+    store.positions[index], store.rotations[index], SAUCER_ORIGIN, SHAPE);
+  std::copy(polygon.vertices.begin(), polygon.vertices.end(),
+            store.vertices[index].begin());
+}
+
+Polygon<Saucer::POINT_COUNT> Saucer::get_polygon(const EntityStore &store,
+                                                 unsigned int index) {
+  Polygon<POINT_COUNT> polygon;
+  std::copy_n(store.vertices[index].begin(), POINT_COUNT,
+              polygon.vertices.begin());
+  return polygon;
+}
+
+sf::FloatRect Saucer::get_bounds(const EntityStore &store,
+                                 unsigned int index) {
+  return polygon_bounds(get_polygon(store, index), OUTLINE_THICKNESS);
+}
+
+const std::array<sf::Vector2f, Saucer::POINT_COUNT> &Saucer::get_shape() {
+  return SHAPE;
+}
+
+}
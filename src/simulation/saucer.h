@@ -0,0 +1,49 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_SAUCER_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_SAUCER_H
+
+#include <array>
+#include <cstddef>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "command_buffer.h"
+#include "entity_store.h"
+#include "polygon.h"
+
+namespace ag {
+
+// Saucers cross the screen in a straight line, firing at the player
+// whenever their gun has cooled down.
+class Saucer {
+ public:
+  static const unsigned int SCORE_VALUE = 10000U;
+  static const std::size_t POINT_COUNT = 4U;
+
+  // A saucer crossing the screen at right angles to rotation, for a command
+  // buffer or the store to add.
+  static ObjectSpawn make(sf::Vector2f starting_pos, float rotation);
+  // Adds a saucer and returns its index.
+  static unsigned int spawn(EntityStore &store, sf::Vector2f starting_pos,
+                            float rotation);
+  static void update(EntityStore &store, unsigned int index, float dt);
+  static void aim(EntityStore &store, unsigned int index,
+                  sf::Vector2f player_position);
+  // Fires the saucer's gun where it last aimed, recording the bullet.
+  static void spawn_child(EntityStore &store, unsigned int index,
+                          CommandBuffer &commands);
+  // Transforms the outline into the store's vertices; refresh_bounds calls
+  // it once a tick.
+  static void refresh_vertices(EntityStore &store, unsigned int index);
+  // The outline as of the last refresh_bounds.
+  static Polygon<POINT_COUNT> get_polygon(const EntityStore &store,
+                                          unsigned int index);
+  static sf::FloatRect get_bounds(const EntityStore &store,
+                                  unsigned int index);
+  // The outline in the local frame, before the transform is applied.
+  static const std::array<sf::Vector2f, POINT_COUNT> &get_shape();
+};
+
+}
+
+#endif
@@ -0,0 +1,229 @@
+#include "scenario.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <SFML/System.hpp>
+
+#include "collision_manager.h"
+#include "game_object.h"
+#include "input.h"
+#include "random.h"
+#include "simulation.h"
+
+namespace ag {
+
+namespace {
+
+const char *BROADPHASE_NAMES[] = {"quadtree", "loose_quadtree", "grid",
+                                  "sweep_and_prune"};
+const char *TYPE_NAMES[] = {"player", "asteroid", "bullet", "saucer"};
+const char *BUTTON_NAMES[] = {"thrust", "reverse", "turn_left", "turn_right",
+                              "fire"};
+// Placement draws from its own stream so that it leaves the simulation's
+// stream, and so the game that follows, as the seed alone would have it.
+const unsigned int PLACEMENT_STREAM = 1U;
+
+template <std::size_t COUNT>
+bool find_name(const char *(&names)[COUNT], const std::string &name,
+               int &index) {
+  for (std::size_t i = 0U; i < COUNT; i++) {
+    if (name == names[i]) {
+      index = static_cast<int>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Reads the next word as a number, failing unless the whole word is one.
+// Unsigned fields refuse a minus sign, which extraction would otherwise
+// accept and wrap round to a huge count.
+template <typename T>
+bool read_number(std::istream &words, T &value) {
+  std::string word;
+  if (!(words >> word) ||
+      (std::is_unsigned<T>::value && word[0] == '-')) {
+    return false;
+  }
+  std::istringstream number{word};
+  std::string rest;
+  return number >> value && !(number >> rest);
+}
+
+// Whether the line has no words left.
+bool at_end(std::istream &words) {
+  std::string word;
+  return !(words >> word);
+}
+
+}
+
+Scenario::Scenario()
+    : m_seed{1U}, m_tick_count{600U}, m_tick_rate{60.0F},
+      m_broadphase{CollisionManager::QuadTreeBroadphase} {}
+
+bool Scenario::load(const std::string &path) {
+  std::ifstream file{path};
+  if (!file) {
+    m_error = "could not open " + path;
+    return false;
+  }
+  std::size_t start = path.find_last_of("/\\");
+  m_name = path.substr(start == std::string::npos ? 0U : start + 1U);
+  m_name = m_name.substr(0U, m_name.find('.'));
+  std::string line;
+  for (unsigned int number = 1U; std::getline(file, line); number++) {
+    if (!parse_line(line)) {
+      m_error = path + ":" + std::to_string(number) + ": " + line;
+      return false;
+    }
+  }
+  return true;
+}
+
+const std::string &Scenario::get_name() const {
+  return m_name;
+}
+
+const std::string &Scenario::get_error() const {
+  return m_error;
+}
+
+std::uint64_t Scenario::get_seed() const {
+  return m_seed;
+}
+
+unsigned int Scenario::get_tick_count() const {
+  return m_tick_count;
+}
+
+float Scenario::get_tick_rate() const {
+  return m_tick_rate;
+}
+
+const Input &Scenario::get_input() const {
+  return m_input;
+}
+
+void Scenario::start(Simulation &simulation) {
+  CollisionManager &collision_manager = simulation.get_collision_manager();
+  collision_manager.set_broadphase(m_broadphase);
+  for (std::size_t i = 0U; i + 1U < m_ignored.size(); i += 2U) {
+    collision_manager.set_collides(m_ignored[i], m_ignored[i + 1U], false);
+  }
+  Input confirm;
+  confirm.press(Input::ConfirmButton);
+  simulation.apply_input(confirm);
+  simulation.update(1.0F / m_tick_rate);
+  m_random.seed(m_seed, PLACEMENT_STREAM);
+  for (auto &&population : m_populations) {
+    add_objects(simulation, population, population.count);
+  }
+}
+
+void Scenario::refill(Simulation &simulation) {
+  m_counts.assign(GameObject::NullType, 0U);
+  for (auto &&type : simulation.get_game_objects().types) {
+    m_counts[type]++;
+  }
+  for (auto &&population : m_populations) {
+    unsigned int &count = m_counts[population.type];
+    if (population.refill && count < population.count) {
+      add_objects(simulation, population, population.count - count);
+      count = population.count;
+    }
+  }
+}
+
+bool Scenario::parse_line(const std::string &line) {
+  std::istringstream words{line};
+  std::string key;
+  if (!(words >> key) || key[0] == '#') {
+    return true;
+  }
+  std::string word;
+  int index;
+  if (key == "seed") {
+    return read_number(words, m_seed) && at_end(words);
+  } else if (key == "ticks") {
+    return read_number(words, m_tick_count) && at_end(words);
+  } else if (key == "tick_rate") {
+    return read_number(words, m_tick_rate) && m_tick_rate > 0.0F &&
+           at_end(words);
+  } else if (key == "broadphase") {
+    if (!(words >> word) || !find_name(BROADPHASE_NAMES, word, index)) {
+      return false;
+    }
+    m_broadphase = static_cast<CollisionManager::BroadphaseType>(index);
+    return at_end(words);
+  } else if (key == "ignore") {
+    for (int i = 0; i < 2; i++) {
+      if (!(words >> word) || !find_name(TYPE_NAMES, word, index)) {
+        return false;
+      }
+      m_ignored.push_back(static_cast<GameObject::ObjectType>(index));
+    }
+    return at_end(words);
+  } else if (key == "input") {
+    while (words >> word) {
+      if (!find_name(BUTTON_NAMES, word, index)) {
+        return false;
+      }
+      m_input.press(static_cast<Input::Button>(index));
+    }
+    return true;
+  }
+  Population population{GameObject::NullType, 0U, 50.0F, false};
+  if (key == "asteroids") {
+    population.type = GameObject::AsteroidType;
+  } else if (key == "bullets") {
+    population.type = GameObject::BulletType;
+  } else if (key == "saucers") {
+    population.type = GameObject::SaucerType;
+  } else {
+    return false;
+  }
+  if (!read_number(words, population.count)) {
+    return false;
+  }
+  while (words >> word) {
+    if (word == "refill") {
+      population.refill = true;
+    } else if (population.type == GameObject::AsteroidType) {
+      std::istringstream size{word};
+      if (!read_number(size, population.size) || population.size <= 0.0F) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+  m_populations.push_back(population);
+  return true;
+}
+
+void Scenario::add_objects(Simulation &simulation,
+                           const Population &population, unsigned int count) {
+  sf::Vector2f world_size = simulation.get_world_size();
+  for (unsigned int i = 0U; i < count; i++) {
+    sf::Vector2f position{m_random.next_float(0.0F, world_size.x),
+                          m_random.next_float(0.0F, world_size.y)};
+    float rotation = m_random.next_float(0.0F, 360.0F);
+    if (population.type == GameObject::AsteroidType) {
+      simulation.add_asteroid(population.size, position, rotation);
+    } else if (population.type == GameObject::BulletType) {
+      simulation.add_bullet(GameObject::PlayerType, position, rotation,
+                            BULLET_LIFETIME);
+    } else {
+      simulation.add_saucer(position, rotation);
+    }
+  }
+}
+
+}
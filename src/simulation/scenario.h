@@ -0,0 +1,86 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_SCENARIO_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_SCENARIO_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "collision_manager.h"
+#include "game_object.h"
+#include "input.h"
+#include "random.h"
+#include "simulation.h"
+
+namespace ag {
+
+// A named stress configuration read from a text file: a game started at a
+// seed, filled with extra asteroids, bullets and saucers, and stepped for a
+// fixed number of ticks with the same buttons held throughout.
+//
+// Files hold one setting per line; blank lines and lines starting with '#'
+// are ignored:
+//   seed <n>                         simulation seed (default 1)
+//   ticks <n>                        ticks to run (default 600)
+//   tick_rate <hz>                   ticks per second (default 60)
+//   broadphase <name>                quadtree, loose_quadtree, grid or
+//                                    sweep_and_prune (default quadtree)
+//   ignore <type> <type>             objects of the two types pass through
+//                                    each other; types are player, asteroid,
+//                                    bullet and saucer
+//   input <button>...                thrust, reverse, turn_left, turn_right
+//                                    or fire, held every tick
+//   asteroids <count> [size] [refill]
+//   bullets <count> [refill]
+//   saucers <count> [refill]
+// Populations are placed at random over the world when the game starts; a
+// refilled one is topped back up to its count before every tick. A line
+// with words left over, or a number that is malformed or negative where a
+// count is expected, fails the load.
+class Scenario {
+ public:
+  struct Population {
+    GameObject::ObjectType type;
+    unsigned int count;
+    float size;
+    bool refill;
+  };
+
+  Scenario();
+  ~Scenario() {};
+
+  // On failure, get_error() says which line was wrong.
+  bool load(const std::string &path);
+  const std::string &get_name() const;
+  const std::string &get_error() const;
+  std::uint64_t get_seed() const;
+  unsigned int get_tick_count() const;
+  float get_tick_rate() const;
+  const Input &get_input() const;
+  // Starts a game in the simulation and adds every population to it.
+  void start(Simulation &simulation);
+  // Tops refilled populations back up; call it before each update.
+  void refill(Simulation &simulation);
+
+ private:
+  bool parse_line(const std::string &line);
+  void add_objects(Simulation &simulation, const Population &population,
+                   unsigned int count);
+
+  const float BULLET_LIFETIME = 2.0F;
+
+  std::string m_name;
+  std::string m_error;
+  std::uint64_t m_seed;
+  unsigned int m_tick_count;
+  float m_tick_rate;
+  CollisionManager::BroadphaseType m_broadphase;
+  std::vector<GameObject::ObjectType> m_ignored;
+  Input m_input;
+  std::vector<Population> m_populations;
+  std::vector<unsigned int> m_counts;
+  Random m_random;
+};
+
+}
+
+#endif
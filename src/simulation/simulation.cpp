@@ -0,0 +1,391 @@
+#include "simulation.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System.hpp>
+
+#include "allocation_tracker.h"
+#include "asteroid.h"
+#include "bullet.h"
+#include "collision_manager.h"
+#include "command_buffer.h"
+#include "entity_store.h"
+#include "game_object.h"
+#include "input.h"
+#include "profiler.h"
+#include "random.h"
+#include "saucer.h"
+#include "spaceship.h"
+#include "state_manager.h"
+#include "world.h"
+
+namespace ag {
+
+namespace {
+
+const char *PHASE_NAMES[] = {"move", "collide", "resolve", "spawn",
+                             "cleanup"};
+
+// Splits [first, last) into one contiguous range per command buffer, in
+// order, and hands each range to pass along with its buffer. A pass writes
+// only the rows in its range, so the ranges could run on as many threads;
+// they run one after another here.
+template <std::size_t WORKERS, typename Pass>
+void split_work(std::size_t first, std::size_t last,
+                std::array<CommandBuffer, WORKERS> &buffers, Pass pass) {
+  std::size_t count = last - first;
+  for (std::size_t worker = 0U; worker < WORKERS; worker++) {
+    pass(first + count * worker / WORKERS,
+         first + count * (worker + 1U) / WORKERS, buffers[worker]);
+  }
+}
+
+}
+
+Simulation::Simulation(std::uint64_t seed)
+    : m_random{seed}, m_collision_manager{m_world.get_size()},
+      m_player{m_objects, m_world.get_center()}, m_events{0U, 0U},
+      m_phase_seconds{}, m_difficulty{0U}, m_saucer_timer{SAUCER_INTERVAL} {
+  spawn_asteroids(STARTING_ASTEROIDS);
+}
+
+bool Simulation::is_running() const {
+  return m_game_state.is_running();
+}
+
+StateManager &Simulation::get_game_state() {
+  return m_game_state;
+}
+
+const StateManager &Simulation::get_game_state() const {
+  return m_game_state;
+}
+
+CollisionManager &Simulation::get_collision_manager() {
+  return m_collision_manager;
+}
+
+const Spaceship &Simulation::get_player() const {
+  return m_player;
+}
+
+const EntityStore &Simulation::get_game_objects() const {
+  return m_objects;
+}
+
+sf::Vector2f Simulation::get_world_size() const {
+  return m_world.get_size();
+}
+
+unsigned int Simulation::get_level() const {
+  return m_difficulty + 1U;
+}
+
+std::uint64_t Simulation::get_seed() const {
+  return m_random.get_seed();
+}
+
+const Simulation::Events &Simulation::get_events() const {
+  return m_events;
+}
+
+const std::array<double, Simulation::PhaseCount> &
+Simulation::get_phase_seconds() const {
+  return m_phase_seconds;
+}
+
+const char *Simulation::get_phase_name(Simulation::Phase phase) {
+  return PHASE_NAMES[phase];
+}
+
+// Buttons pressed together in one tick always apply in the same order, so a
+// replay reaches the same state however the front-end ordered them.
+void Simulation::apply_input(const Input &input) {
+  if (input.is_pressed(Input::PauseButton) && m_game_state.in_game()) {
+    m_game_state.pause_game();
+  }
+  if (input.is_pressed(Input::BackButton)) {
+    m_game_state.update_game_state(StateManager::BackInput);
+  }
+  if (input.is_pressed(Input::ConfirmButton)) {
+    m_game_state.update_game_state(StateManager::ConfirmInput);
+  }
+  if (m_game_state.in_game()) {
+    m_player.control_ship(input.get_controls());
+  }
+}
+
+void Simulation::add_asteroid(float size, sf::Vector2f position,
+                              float rotation) {
+  Asteroid::spawn(m_objects, size, position, rotation);
+}
+
+void Simulation::add_saucer(sf::Vector2f position, float rotation) {
+  Saucer::spawn(m_objects, position, rotation);
+}
+
+void Simulation::add_bullet(GameObject::ObjectType parent_type,
+                            sf::Vector2f position, float rotation,
+                            float lifetime) {
+  Bullet::spawn(m_objects, parent_type, rotation, sf::Vector2f{0.0F, 0.0F},
+                position, lifetime);
+}
+
+// Contacts and spawns are recorded as commands and applied at the end of
+// their phase, so new objects join the store after every existing one has
+// had its turn and first move next tick.
+void Simulation::update(float dt) {
+  m_events = Events{0U, 0U};
+  m_phase_seconds.fill(0.0);
+  m_objects.store_previous_transforms();
+  if (m_game_state.load()) {
+    clear_level();
+    spawn_asteroids(STARTING_ASTEROIDS + m_difficulty);
+    m_game_state.start_game();
+  } else if (m_game_state.in_game()) {
+    std::chrono::steady_clock::time_point phase_start =
+      std::chrono::steady_clock::now();
+    const char *outer_zone =
+      AllocationTracker::enter_zone(PHASE_NAMES[MovePhase]);
+    move_objects(dt);
+    m_objects.refresh_bounds();
+    end_phase(MovePhase, phase_start);
+    const std::vector<CollisionManager::Contact> &contacts =
+      m_collision_manager.collision_check(m_objects);
+    m_events.contacts = static_cast<unsigned int>(contacts.size());
+    end_phase(CollidePhase, phase_start);
+    split_work(0U, contacts.size(), m_commands,
+               [&](std::size_t first, std::size_t last,
+                   CommandBuffer &commands) {
+                 record_contacts(contacts, first, last, commands);
+               });
+    apply_commands();
+    end_phase(ResolvePhase, phase_start);
+    // The player, always first, fires and wraps before the rest, who aim at
+    // where it ends up.
+    if (m_player.is_shooting()) {
+      m_player.spawn_child(m_objects, m_commands[0]);
+    }
+    keep_on_camera(m_player.get_index());
+    split_work(1U, m_objects.size(), m_commands,
+               [&](std::size_t first, std::size_t last,
+                   CommandBuffer &commands) {
+                 record_spawns(first, last, commands);
+               });
+    // A timed saucer goes in the last worker's buffer, so that it joins the
+    // store after everything the pass spawned.
+    if (m_saucer_timer <= 0.0F) {
+      sf::Vector2f position = m_world.saucer_spawn_position(m_random);
+      float rotation = 0.0F;
+      if (position.y > m_world.get_center().y) {
+        rotation = 180.0F;
+      }
+      m_commands.back().spawn(Saucer::make(position, rotation));
+      m_saucer_timer = SAUCER_INTERVAL;
+    } else {
+      m_saucer_timer -= dt;
+    }
+    apply_commands();
+    end_phase(SpawnPhase, phase_start);
+    for (std::size_t i = 1U; i < m_objects.size(); i++) {
+      if (m_objects.destroyed[i]) {
+        m_collision_manager.remove(m_objects.handles[i]);
+      }
+    }
+    m_objects.compact(1U);
+    end_phase(CleanupPhase, phase_start);
+    AllocationTracker::leave_zone(outer_zone);
+    if (m_objects.get_pool_stats(GameObject::AsteroidType).live == 0U) {
+      m_game_state.next_level();
+      m_difficulty++;
+      m_player.reset_ship(m_objects);
+    }
+    if (m_objects.destroyed[m_player.get_index()]) {
+      m_game_state.end_game();
+    }
+  } else if (m_game_state.title_screen()) {
+    for (std::size_t i = 0U; i < m_objects.size(); i++) {
+      if (m_objects.types[i] == GameObject::AsteroidType) {
+        m_objects.positions[i] += m_objects.velocities[i] * dt;
+        m_objects.moved[i] = 1U;
+      }
+    }
+  } else if (m_game_state.reset()) {
+    reset_game();
+  }
+}
+
+void Simulation::spawn_asteroids(unsigned int asteroid_count) {
+  ProfileZone zone{"spawn_asteroids"};
+  for (unsigned int i = 0U; i < asteroid_count; ++i) {
+    Asteroid::spawn(m_objects, L_ASTEROID,
+                    m_world.valid_asteroid_position(m_objects, m_random),
+                    static_cast<float>(m_random.next_below(360U)));
+  }
+}
+
+// The player steers first, then every object with a velocity moves in one
+// pass over the packed positions, and finally bullets age and saucers' guns
+// cool down.
+void Simulation::move_objects(float dt) {
+  m_player.update(m_objects, dt);
+  std::size_t count = m_objects.size();
+  for (std::size_t i = 0U; i < count; i++) {
+    if (m_objects.velocities[i] != sf::Vector2f{0.0F, 0.0F}) {
+      m_objects.positions[i] += m_objects.velocities[i] * dt;
+      m_objects.moved[i] = 1U;
+    }
+  }
+  for (unsigned int i = 0U; i < count; i++) {
+    if (m_objects.types[i] == GameObject::BulletType) {
+      m_objects.ttls[i] -= dt;
+      if (m_objects.ttls[i] <= 0.0F) {
+        m_objects.destroyed[i] = 1U;
+      }
+    } else if (m_objects.types[i] == GameObject::SaucerType) {
+      Saucer::update(m_objects, i, dt);
+    }
+  }
+}
+
+// Charges the time since start to the phase, and to a profiler zone of the
+// same name, then starts timing the next one and charging allocations to it.
+void Simulation::end_phase(Simulation::Phase phase,
+                           std::chrono::steady_clock::time_point &start) {
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::chrono::duration<double> elapsed = now - start;
+  m_phase_seconds[phase] = elapsed.count();
+  Profiler::record(PHASE_NAMES[phase], start, now);
+  if (phase + 1 < PhaseCount) {
+    AllocationTracker::enter_zone(PHASE_NAMES[phase + 1]);
+  }
+  start = now;
+}
+
+// Records the destruction of both objects in every contact, and points for
+// each asteroid or saucer hit by a player bullet; the commands' application
+// takes care of objects in several contacts.
+void Simulation::record_contacts(
+    const std::vector<CollisionManager::Contact> &contacts, std::size_t first,
+    std::size_t last, CommandBuffer &commands) {
+  for (std::size_t i = first; i < last; i++) {
+    const CollisionManager::Contact &contact = contacts[i];
+    commands.destroy(m_objects.handles[contact.first]);
+    commands.destroy(m_objects.handles[contact.second]);
+    record_score(contact.first, contact.second, commands);
+    record_score(contact.second, contact.first, commands);
+  }
+}
+
+void Simulation::record_score(unsigned int bullet, unsigned int target,
+                              CommandBuffer &commands) const {
+  if (m_objects.types[bullet] != GameObject::BulletType ||
+      m_objects.parent_types[bullet] != GameObject::PlayerType) {
+    return;
+  }
+  if (m_objects.types[target] == GameObject::AsteroidType) {
+    commands.score(m_objects.handles[target], Asteroid::SCORE_VALUE);
+  } else if (m_objects.types[target] == GameObject::SaucerType) {
+    commands.score(m_objects.handles[target], Saucer::SCORE_VALUE);
+  }
+}
+
+// Saucers aim at the player and fire when their gun is ready, and destroyed
+// asteroids large enough to split do so.
+void Simulation::record_spawns(std::size_t first, std::size_t last,
+                               CommandBuffer &commands) {
+  sf::Vector2f player_position = m_objects.positions[m_player.get_index()];
+  for (unsigned int i = static_cast<unsigned int>(first); i < last; i++) {
+    GameObject::ObjectType type = m_objects.types[i];
+    if (type == GameObject::SaucerType) {
+      Saucer::aim(m_objects, i, player_position);
+      if (m_objects.shooting[i]) {
+        Saucer::spawn_child(m_objects, i, commands);
+      }
+    } else if (type == GameObject::AsteroidType && m_objects.destroyed[i] &&
+               m_objects.radii[i] > S_ASTEROID) {
+      Asteroid::spawn_child(m_objects, i, 90.0F, commands);
+      Asteroid::spawn_child(m_objects, i, -90.0F, commands);
+    }
+    keep_on_camera(i);
+  }
+}
+
+// Objects that leave the world come back on the other side, except saucers,
+// which are done once they have crossed the screen and left it entirely.
+void Simulation::keep_on_camera(unsigned int index) {
+  if (m_objects.types[index] == GameObject::SaucerType) {
+    if (m_world.off_camera(m_objects.positions[index],
+                           m_objects.radii[index])) {
+      m_objects.destroyed[index] = 1U;
+    }
+  } else if (m_world.outside(m_objects.positions[index])) {
+    m_world.wrap_object(m_objects, index);
+  }
+}
+
+// The sync point at the end of a pass. Every buffer applies in worker order:
+// all the scores, each target scoring once, then the destroys, with the
+// player losing one life however many times it was hit, and last the spawns,
+// appended in the order they were recorded. Scores go first so that a life
+// earned by the same volley that kills the ship counts.
+void Simulation::apply_commands() {
+  m_scored.assign(m_objects.size(), false);
+  for (auto &&commands : m_commands) {
+    for (auto &&score : commands.get_scores()) {
+      unsigned int index = m_objects.find(score.target);
+      if (index != EntityStore::NOT_FOUND && !m_scored[index]) {
+        m_scored[index] = true;
+        m_player.increment_score(score.points);
+      }
+    }
+  }
+  bool player_hit = false;
+  for (auto &&commands : m_commands) {
+    for (auto &&handle : commands.get_destroys()) {
+      unsigned int index = m_objects.find(handle);
+      if (index == m_player.get_index()) {
+        player_hit = true;
+      } else if (index != EntityStore::NOT_FOUND) {
+        m_objects.destroyed[index] = 1U;
+      }
+    }
+  }
+  if (player_hit) {
+    m_player.collide(m_objects);
+  }
+  for (auto &&commands : m_commands) {
+    for (auto &&spawn : commands.get_spawns()) {
+      if (m_objects.add(spawn) != EntityStore::NOT_FOUND &&
+          spawn.type == GameObject::BulletType) {
+        m_events.shots++;
+      }
+    }
+    commands.clear();
+  }
+}
+
+void Simulation::clear_level() {
+  for (std::size_t i = 1U; i < m_objects.size(); i++) {
+    m_collision_manager.remove(m_objects.handles[i]);
+  }
+  m_objects.truncate(1U);
+}
+
+void Simulation::reset_game() {
+  m_difficulty = 0U;
+  m_saucer_timer = SAUCER_INTERVAL;
+  m_game_state.reset_game_state();
+  m_player.reset_lives();
+  m_player.reset_score();
+  m_player.reset_ship(m_objects);
+  clear_level();
+  spawn_asteroids(STARTING_ASTEROIDS);
+}
+
+}
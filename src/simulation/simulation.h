@@ -0,0 +1,113 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_SIMULATION_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_SIMULATION_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System.hpp>
+
+#include "collision_manager.h"
+#include "command_buffer.h"
+#include "entity_store.h"
+#include "game_object.h"
+#include "input.h"
+#include "random.h"
+#include "spaceship.h"
+#include "state_manager.h"
+#include "world.h"
+
+namespace ag {
+
+// Everything that decides how a game plays out: the objects, collisions,
+// spawning, scoring and level progression. It needs no window, audio device
+// or font; front-ends feed it input and present what it reports.
+class Simulation {
+ public:
+  // What happened during the last update, for front-ends to react to.
+  struct Events {
+    unsigned int shots;
+    unsigned int contacts;
+  };
+
+  // The stages of an in-game update, in the order they run.
+  enum Phase {
+    MovePhase,
+    CollidePhase,
+    ResolvePhase,
+    SpawnPhase,
+    CleanupPhase,
+    PhaseCount
+  };
+
+  // Games built with the same seed and fed the same input play out the same.
+  explicit Simulation(std::uint64_t seed = 0U);
+  ~Simulation() {};
+
+  bool is_running() const;
+  StateManager &get_game_state();
+  const StateManager &get_game_state() const;
+  CollisionManager &get_collision_manager();
+  const Spaceship &get_player() const;
+  // Every object in the game, the player first.
+  const EntityStore &get_game_objects() const;
+  sf::Vector2f get_world_size() const;
+  unsigned int get_level() const;
+  std::uint64_t get_seed() const;
+  const Simulation::Events &get_events() const;
+  // Seconds each phase of the last update took; zero outside of a game.
+  const std::array<double, PhaseCount> &get_phase_seconds() const;
+  static const char *get_phase_name(Simulation::Phase phase);
+  // Applies one tick's input; call it before each update.
+  void apply_input(const Input &input);
+  // Adds an asteroid to the current level, wherever it is asked for.
+  void add_asteroid(float size, sf::Vector2f position, float rotation);
+  void add_saucer(sf::Vector2f position, float rotation);
+  void add_bullet(GameObject::ObjectType parent_type, sf::Vector2f position,
+                  float rotation, float lifetime);
+  void update(float dt);
+
+ private:
+  const unsigned int STARTING_ASTEROIDS = 3U;
+  const float L_ASTEROID = 50.0F;
+  const float S_ASTEROID = 12.5F;
+  const float SAUCER_INTERVAL = 5.0F;
+  // The ranges the resolve and spawn passes split their work into, each
+  // recording into its own command buffer.
+  static const std::size_t WORKER_COUNT = 4U;
+
+  void spawn_asteroids(unsigned int asteroid_count);
+  void move_objects(float dt);
+  void end_phase(Simulation::Phase phase,
+                 std::chrono::steady_clock::time_point &start);
+  void record_contacts(const std::vector<CollisionManager::Contact> &contacts,
+                       std::size_t first, std::size_t last,
+                       CommandBuffer &commands);
+  void record_score(unsigned int bullet, unsigned int target,
+                    CommandBuffer &commands) const;
+  void record_spawns(std::size_t first, std::size_t last,
+                     CommandBuffer &commands);
+  void keep_on_camera(unsigned int index);
+  void apply_commands();
+  void clear_level();
+  void reset_game();
+
+  Random m_random;
+  StateManager m_game_state;
+  World m_world;
+  CollisionManager m_collision_manager;
+  EntityStore m_objects;
+  Spaceship m_player;
+  std::array<CommandBuffer, WORKER_COUNT> m_commands;
+  std::vector<bool> m_scored;
+  Simulation::Events m_events;
+  std::array<double, PhaseCount> m_phase_seconds;
+  unsigned int m_difficulty;
+  float m_saucer_timer;
+};
+
+}
+
+#endif
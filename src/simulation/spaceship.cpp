@@ -0,0 +1,169 @@
+#include "spaceship.h"
+
+#include <algorithm>
+#include <array>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "bullet.h"
+#include "command_buffer.h"
+#include "entity_store.h"
+#include "game_object.h"
+#include "helpers.h"
+#include "polygon.h"
+
+namespace ag {
+
+namespace {
+
+const float SHIP_RADIUS = 10.0F;
+const float BULLET_LIFETIME = 2.0F;
+const float OUTLINE_THICKNESS = 1.0F;
+const sf::Vector2f SHIP_ORIGIN{7.5F, 10.0F};
+const std::array<sf::Vector2f, Spaceship::POINT_COUNT> SHAPE{
+  sf::Vector2f{7.5F, 0.0F}, sf::Vector2f{0.0F, 20.0F},
+  sf::Vector2f{15.0F, 20.0F}
+};
+
+}
+
+Spaceship::Spaceship(EntityStore &store, sf::Vector2f starting_position)
+    : m_starting_position{starting_position}, m_thrust{0.0F},
+      m_angular_velocity{0.0F}, m_gun_cd{0.0F}, m_shooting{false},
+      m_lives{STARTING_LIVES}, m_score{0U} {
+  m_index = store.add(GameObject::PlayerType, m_starting_position, 0.0F,
+                      sf::Vector2f{0.0F, 0.0F}, SHIP_RADIUS, SHIP_ORIGIN);
+}
+
+unsigned int Spaceship::get_index() const {
+  return m_index;
+}
+
+bool Spaceship::is_shooting() const {
+  return m_shooting;
+}
+
+void Spaceship::collide(EntityStore &store) {
+  m_lives--;
+  if (m_lives <= 0U) {
+    store.destroyed[m_index] = 1U;
+  } else {
+    reset_ship(store);
+  }
+}
+
+void Spaceship::update(EntityStore &store, float dt) {
+  sf::Vector2f &velocity = store.velocities[m_index];
+  velocity += GameObject::heading(store.rotations[m_index]) * m_thrust;
+  if (vector2f_length(velocity) > MAX_SPEED) {
+    velocity = normalize_vector2f(velocity) * MAX_SPEED;
+  }
+  if (m_angular_velocity != 0.0F) {
+    store.rotate(m_index, -(m_angular_velocity * dt));
+  }
+  if (!m_shooting && m_gun_cd > 0.0F) {
+    m_gun_cd -= dt;
+  }
+}
+
+void Spaceship::spawn_child(const EntityStore &store,
+                            CommandBuffer &commands) {
+  m_shooting = false;
+  m_gun_cd = GUN_COOLDOWN;
+  sf::Vector2f gun_position = GameObject::transform_point(
+    store.positions[m_index], store.rotations[m_index], SHIP_ORIGIN,
+    SHAPE[0] - sf::Vector2f{0.0F, 3.0F});
+  commands.spawn(Bullet::make(GameObject::PlayerType,
+                              store.rotations[m_index],
+                              store.velocities[m_index], gun_position,
+                              BULLET_LIFETIME));
+}
+
+unsigned int Spaceship::get_lives() const {
+  return m_lives;
+}
+
+unsigned int Spaceship::get_score() const {
+  return m_score;
+}
+
+void Spaceship::increment_score(unsigned int increment) {
+  unsigned int previous_score = m_score;
+  m_score = std::min(m_score + increment, 999999U);
+  if (m_score / 50000U > previous_score / 50000U) {
+    m_lives++;
+  }
+}
+
+void Spaceship::control_ship(const Spaceship::Controls &controls) {
+  if (controls.fire) {
+    if (m_gun_cd <= 0.0F) {
+      m_shooting = true;
+    }
+  }
+  if (controls.thrust) {
+    m_thrust = FORWARD_ACCELERATION;
+  } else if (controls.reverse) {
+    m_thrust = REVERSE_ACCELERATION;
+  } else {
+    m_thrust = 0.0F;
+  }
+  if (controls.turn_left) {
+    m_angular_velocity = ROTATION_SPEED;
+  } else if (controls.turn_right) {
+    m_angular_velocity = -ROTATION_SPEED;
+  } else {
+    m_angular_velocity = 0.0F;
+  }
+}
+
+void Spaceship::reset_lives() {
+  m_lives = STARTING_LIVES;
+}
+
+void Spaceship::reset_score() {
+  m_score = 0U;
+}
+
+void Spaceship::reset_ship(EntityStore &store) {
+  store.positions[m_index] = m_starting_position;
+  store.rotations[m_index] = 0.0F;
+  store.moved[m_index] = 1U;
+  store.previous_positions[m_index] = m_starting_position;
+  store.previous_rotations[m_index] = 0.0F;
+  store.velocities[m_index] = sf::Vector2f{0.0F, 0.0F};
+  store.destroyed[m_index] = 0U;
+  m_gun_cd = 0.0F;
+  m_shooting = false;
+}
+
+static_assert(Spaceship::POINT_COUNT <= EntityStore::MAX_VERTICES,
+              "the store has no room for the outline");
+
+void Spaceship::refresh_vertices(EntityStore &store, unsigned int index) {
+  Polygon<POINT_COUNT> polygon = GameObject::transform_polygon(
+    store.positions[index], store.rotations[index], SHIP_ORIGIN, SHAPE);
+  std::copy(polygon.vertices.begin(), polygon.vertices.end(),
+            store.vertices[index].begin());
+}
+
+Polygon<Spaceship::POINT_COUNT> Spaceship::get_polygon(
+    const EntityStore &store, unsigned int index) {
+  Polygon<POINT_COUNT> polygon;
+  std::copy_n(store.vertices[index].begin(), POINT_COUNT,
+              polygon.vertices.begin());
+  return polygon;
+}
+
+sf::FloatRect Spaceship::get_bounds(const EntityStore &store,
+                                    unsigned int index) {
+  return polygon_bounds(get_polygon(store, index), OUTLINE_THICKNESS);
+}
+
+const std::array<sf::Vector2f, Spaceship::POINT_COUNT> &
+Spaceship::get_shape() {
+  return SHAPE;
+}
+
+}
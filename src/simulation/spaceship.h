@@ -0,0 +1,80 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_SPACESHIP_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_SPACESHIP_H
+
+#include <array>
+#include <cstddef>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "command_buffer.h"
+#include "entity_store.h"
+#include "polygon.h"
+
+namespace ag {
+
+// The player's ship. Its transform lives in the entity store like any other
+// object's; the pilot's controls, gun, lives and score are kept here.
+class Spaceship {
+ public:
+  static const std::size_t POINT_COUNT = 3U;
+
+  // What the pilot is asking the ship to do this frame.
+  struct Controls {
+    bool thrust;
+    bool reverse;
+    bool turn_left;
+    bool turn_right;
+    bool fire;
+  };
+
+  // Adds the ship to the store.
+  explicit Spaceship(EntityStore &store, sf::Vector2f starting_pos);
+  ~Spaceship() {};
+
+  unsigned int get_index() const;
+  bool is_shooting() const;
+  void collide(EntityStore &store);
+  // Applies thrust and turning ahead of the store moving every object.
+  void update(EntityStore &store, float dt);
+  // Fires the gun, recording the bullet.
+  void spawn_child(const EntityStore &store, CommandBuffer &commands);
+  unsigned int get_lives() const;
+  unsigned int get_score() const;
+  void increment_score(unsigned int increment);
+  void control_ship(const Spaceship::Controls &controls);
+  void reset_lives();
+  void reset_score();
+  void reset_ship(EntityStore &store);
+  // Transforms the outline into the store's vertices; refresh_bounds calls
+  // it once a tick.
+  static void refresh_vertices(EntityStore &store, unsigned int index);
+  // The outline as of the last refresh_bounds.
+  static Polygon<POINT_COUNT> get_polygon(const EntityStore &store,
+                                          unsigned int index);
+  static sf::FloatRect get_bounds(const EntityStore &store,
+                                  unsigned int index);
+  // The outline in the local frame, before the transform is applied.
+  static const std::array<sf::Vector2f, POINT_COUNT> &get_shape();
+
+ private:
+  const float ROTATION_SPEED = 180.0F;
+  const float MAX_SPEED = 300.0F;
+  const float FORWARD_ACCELERATION = 0.75F;
+  const float REVERSE_ACCELERATION = -0.375F;
+  const float GUN_COOLDOWN = 0.5F;
+  const unsigned int STARTING_LIVES = 3U;
+
+  sf::Vector2f m_starting_position;
+  unsigned int m_index;
+  float m_thrust;
+  float m_angular_velocity;
+  float m_gun_cd;
+  bool m_shooting;
+  unsigned int m_lives;
+  unsigned int m_score;
+};
+
+}
+
+#endif
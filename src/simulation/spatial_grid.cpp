@@ -0,0 +1,90 @@
+#include "spatial_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "broadphase.h"
+
+namespace ag {
+
+SpatialGrid::SpatialGrid(sf::Vector2f world_size)
+    : m_query{0U} {
+  m_columns = std::max(1, static_cast<int>(std::round(world_size.x /
+                                                      CELL_SIZE)));
+  m_rows = std::max(1, static_cast<int>(std::round(world_size.y /
+                                                   CELL_SIZE)));
+  m_cell_size = sf::Vector2f{world_size.x / m_columns,
+                             world_size.y / m_rows};
+  m_cell_heads.assign(static_cast<std::size_t>(m_columns * m_rows), -1);
+}
+
+void SpatialGrid::clear() {
+  std::fill(m_cell_heads.begin(), m_cell_heads.end(), -1);
+  m_entries.clear();
+}
+
+void SpatialGrid::insert(unsigned int index, unsigned int id,
+                         sf::FloatRect bounds, Filter filter) {
+  int first_x, last_x, first_y, last_y;
+  cell_range(bounds.left, bounds.left + bounds.width, m_cell_size.x,
+             m_columns, first_x, last_x);
+  cell_range(bounds.top, bounds.top + bounds.height, m_cell_size.y, m_rows,
+             first_y, last_y);
+  for (int y = first_y; y <= last_y; y++) {
+    for (int x = first_x; x <= last_x; x++) {
+      int cell = y * m_columns + x;
+      m_entries.push_back(CellEntry{index, filter, m_cell_heads[cell]});
+      m_cell_heads[cell] = static_cast<int>(m_entries.size()) - 1;
+    }
+  }
+  if (index >= m_visited.size()) {
+    m_visited.resize(index + 1U, 0U);
+  }
+}
+
+void SpatialGrid::retrieve(unsigned int index, sf::FloatRect bounds,
+                           Filter filter,
+                           std::vector<Candidate> &candidates) const {
+  retrieve_area(bounds, filter, candidates);
+}
+
+void SpatialGrid::retrieve_area(sf::FloatRect bounds, Filter filter,
+                                std::vector<Candidate> &candidates) const {
+  if (++m_query == 0U) {
+    std::fill(m_visited.begin(), m_visited.end(), 0U);
+    m_query = 1U;
+  }
+  int first_x, last_x, first_y, last_y;
+  cell_range(bounds.left, bounds.left + bounds.width, m_cell_size.x,
+             m_columns, first_x, last_x);
+  cell_range(bounds.top, bounds.top + bounds.height, m_cell_size.y, m_rows,
+             first_y, last_y);
+  for (int y = first_y; y <= last_y; y++) {
+    for (int x = first_x; x <= last_x; x++) {
+      int entry = m_cell_heads[y * m_columns + x];
+      while (entry != -1) {
+        const CellEntry &cell_entry = m_entries[entry];
+        if (m_visited[cell_entry.index] != m_query &&
+            filter.accepts(cell_entry.filter)) {
+          m_visited[cell_entry.index] = m_query;
+          candidates.push_back(Candidate{cell_entry.index});
+        }
+        entry = cell_entry.next;
+      }
+    }
+  }
+}
+
+void SpatialGrid::cell_range(float low, float high, float cell_size,
+                             int cells, int &first, int &last) const {
+  first = std::min(std::max(static_cast<int>(std::floor(low / cell_size)), 0),
+                   cells - 1);
+  last = std::min(std::max(static_cast<int>(std::floor(high / cell_size)), 0),
+                  cells - 1);
+}
+
+}
@@ -0,0 +1,54 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_SPATIAL_GRID_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_SPATIAL_GRID_H
+
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "broadphase.h"
+
+namespace ag {
+
+// Uniform grid over the world. Bounds past its edges fall into the edge
+// cells; meeting across an edge is left to the collision manager, which
+// queries every broadphase alike for that. Each cell is a linked list
+// threaded through a flat entry array, so nothing is allocated once the
+// arrays have warmed up.
+class SpatialGrid : public Broadphase {
+ public:
+  explicit SpatialGrid(sf::Vector2f world_size);
+  ~SpatialGrid() {};
+
+  void clear() override;
+  void insert(unsigned int index, unsigned int id,
+              sf::FloatRect bounds, Filter filter) override;
+  void retrieve(unsigned int index, sf::FloatRect bounds, Filter filter,
+                std::vector<Candidate> &candidates) const override;
+  void retrieve_area(sf::FloatRect bounds, Filter filter,
+                     std::vector<Candidate> &candidates) const override;
+
+ private:
+  const float CELL_SIZE = 64.0F;
+
+  struct CellEntry {
+    unsigned int index;
+    Filter filter;
+    int next;
+  };
+
+  void cell_range(float low, float high, float cell_size, int cells,
+                  int &first, int &last) const;
+
+  sf::Vector2f m_cell_size;
+  int m_columns;
+  int m_rows;
+  std::vector<int> m_cell_heads;
+  std::vector<CellEntry> m_entries;
+  mutable std::vector<unsigned int> m_visited;
+  mutable unsigned int m_query;
+};
+
+}
+
+#endif
@@ -1,11 +1,6 @@
 #ifndef ASTEROIDS_GAME_CODE_INCLUDE_STATE_MANAGER_H
 #define ASTEROIDS_GAME_CODE_INCLUDE_STATE_MANAGER_H
 
-#include <string>
-
-#include <SFML/Audio.hpp>
-#include <SFML/Graphics.hpp>
-
 namespace ag {
 
 class StateManager {
@@ -19,18 +14,25 @@ class StateManager {
     Reset
   };
 
+  // Menu inputs, independent of the keys a front-end maps onto them.
+  enum MenuInput {
+    ConfirmInput,
+    BackInput,
+    NullInput
+  };
+
   StateManager();
   ~StateManager() {};
 
-  bool load_resources(std::string game_bgm);
   bool is_running() const;
+  StateManager::GameState get_state() const;
   bool title_screen() const;
   bool load() const;
   bool in_game() const;
   bool paused() const;
   bool game_over() const;
   bool reset() const;
-  void update_game_state(sf::Keyboard::Key key);
+  void update_game_state(StateManager::MenuInput input);
   void start_game();
   void pause_game();
   void next_level();
@@ -41,7 +43,6 @@ class StateManager {
  private:
   GameState m_state;
   bool m_running;
-  sf::Music m_game_bgm;
 };
 
 }
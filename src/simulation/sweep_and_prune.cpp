@@ -0,0 +1,180 @@
+#include "sweep_and_prune.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "broadphase.h"
+
+namespace ag {
+
+SweepAndPrune::SweepAndPrune()
+    : m_object_count{0U}, m_pair_count{0U}, m_frame{1U} {}
+
+void SweepAndPrune::clear() {
+  m_object_count = 0U;
+  m_frame++;
+}
+
+void SweepAndPrune::insert(unsigned int index, unsigned int id,
+                           sf::FloatRect bounds, Filter filter) {
+  if (id >= m_proxies.size()) {
+    m_proxies.resize(id + 1U, Proxy{0U, sf::FloatRect{}, Filter{0U, 0U}, 0U,
+                                    0U, false});
+  }
+  Proxy &proxy = m_proxies[id];
+  proxy.index = index;
+  proxy.bounds = bounds;
+  proxy.filter = filter;
+  proxy.frame = m_frame;
+  if (!proxy.listed) {
+    m_endpoints.push_back(Endpoint{bounds.left, id, true});
+    m_endpoints.push_back(Endpoint{bounds.left + bounds.width, id, false});
+    proxy.listed = true;
+  }
+  m_object_count = std::max(m_object_count, index + 1U);
+}
+
+void SweepAndPrune::build() {
+  update_endpoints();
+  sort_endpoints();
+  sweep();
+}
+
+// Pairs were already filtered when they were swept, so the filter is unused.
+void SweepAndPrune::retrieve(unsigned int index, sf::FloatRect bounds,
+                             Filter filter,
+                             std::vector<Candidate> &candidates) const {
+  if (index >= m_object_count) {
+    return;
+  }
+  for (unsigned int i = m_partner_start[index];
+       i < m_partner_start[index + 1U]; i++) {
+    candidates.push_back(Candidate{m_partners[i]});
+  }
+}
+
+// Every box overlapping the area has its minimum below the area's right edge
+// and its maximum above its left edge, so the endpoint list is walked from
+// whichever end has fewer endpoints to pass on the way.
+void SweepAndPrune::retrieve_area(sf::FloatRect bounds, Filter filter,
+                                  std::vector<Candidate> &candidates) const {
+  float left = bounds.left;
+  float right = bounds.left + bounds.width;
+  auto value_less = [](const Endpoint &endpoint, float value)
+                    { return endpoint.value < value; };
+  std::size_t below_right = static_cast<std::size_t>(
+    std::lower_bound(m_endpoints.begin(), m_endpoints.end(), right,
+                     value_less) - m_endpoints.begin());
+  std::size_t above_left = m_endpoints.size() - static_cast<std::size_t>(
+    std::lower_bound(m_endpoints.begin(), m_endpoints.end(), left,
+                     value_less) - m_endpoints.begin());
+  bool from_start = below_right <= above_left;
+  std::size_t first = from_start ? 0U : m_endpoints.size() - above_left;
+  std::size_t last = from_start ? below_right : m_endpoints.size();
+  for (std::size_t i = first; i < last; i++) {
+    const Endpoint &endpoint = m_endpoints[i];
+    if (endpoint.minimum != from_start) {
+      continue;
+    }
+    const Proxy &proxy = m_proxies[endpoint.id];
+    if (proxy.bounds.intersects(bounds) && filter.accepts(proxy.filter)) {
+      candidates.push_back(Candidate{proxy.index});
+    }
+  }
+}
+
+unsigned int SweepAndPrune::get_pair_count() const {
+  return m_pair_count;
+}
+
+bool SweepAndPrune::endpoint_less(const Endpoint &left,
+                                  const Endpoint &right) const {
+  // Maximums sort ahead of minimums at the same value so that boxes which
+  // only touch are not reported, matching sf::FloatRect::intersects.
+  if (left.value != right.value) {
+    return left.value < right.value;
+  }
+  if (left.id == right.id) {
+    return left.minimum && !right.minimum;
+  }
+  return !left.minimum && right.minimum;
+}
+
+void SweepAndPrune::update_endpoints() {
+  for (auto &&endpoint : m_endpoints) {
+    Proxy &proxy = m_proxies[endpoint.id];
+    if (proxy.frame != m_frame) {
+      proxy.listed = false;
+    } else if (endpoint.minimum) {
+      endpoint.value = proxy.bounds.left;
+    } else {
+      endpoint.value = proxy.bounds.left + proxy.bounds.width;
+    }
+  }
+  m_endpoints.erase(std::remove_if(m_endpoints.begin(), m_endpoints.end(),
+                                   [this](const Endpoint &endpoint)
+                                   { return m_proxies[endpoint.id].frame !=
+                                              m_frame; }),
+                    m_endpoints.end());
+}
+
+void SweepAndPrune::sort_endpoints() {
+  for (std::size_t i = 1U; i < m_endpoints.size(); i++) {
+    Endpoint endpoint = m_endpoints[i];
+    std::size_t j = i;
+    while (j > 0U && endpoint_less(endpoint, m_endpoints[j - 1U])) {
+      m_endpoints[j] = m_endpoints[j - 1U];
+      j--;
+    }
+    m_endpoints[j] = endpoint;
+  }
+}
+
+void SweepAndPrune::sweep() {
+  m_active.clear();
+  m_pairs.clear();
+  for (auto &&endpoint : m_endpoints) {
+    Proxy &proxy = m_proxies[endpoint.id];
+    if (endpoint.minimum) {
+      for (auto other_id : m_active) {
+        const sf::FloatRect &other = m_proxies[other_id].bounds;
+        if (proxy.bounds.top < other.top + other.height &&
+            other.top < proxy.bounds.top + proxy.bounds.height &&
+            proxy.filter.accepts(m_proxies[other_id].filter)) {
+          add_pair(proxy.index, m_proxies[other_id].index);
+        }
+      }
+      proxy.active_slot = static_cast<unsigned int>(m_active.size());
+      m_active.push_back(endpoint.id);
+    } else {
+      unsigned int moved_id = m_active.back();
+      m_active[proxy.active_slot] = moved_id;
+      m_proxies[moved_id].active_slot = proxy.active_slot;
+      m_active.pop_back();
+    }
+  }
+  m_pair_count = static_cast<unsigned int>(m_pairs.size() / 2U);
+  m_partner_start.assign(m_object_count + 1U, 0U);
+  for (auto index : m_pairs) {
+    m_partner_start[index + 1U]++;
+  }
+  for (unsigned int i = 0U; i < m_object_count; i++) {
+    m_partner_start[i + 1U] += m_partner_start[i];
+  }
+  m_partners.resize(m_pairs.size());
+  m_partner_end.assign(m_partner_start.begin(), m_partner_start.end() - 1);
+  for (std::size_t i = 0U; i < m_pairs.size(); i += 2U) {
+    m_partners[m_partner_end[m_pairs[i]]++] = m_pairs[i + 1U];
+    m_partners[m_partner_end[m_pairs[i + 1U]]++] = m_pairs[i];
+  }
+}
+
+void SweepAndPrune::add_pair(unsigned int first, unsigned int second) {
+  m_pairs.push_back(first);
+  m_pairs.push_back(second);
+}
+
+}
@@ -0,0 +1,68 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_SWEEP_AND_PRUNE_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_SWEEP_AND_PRUNE_H
+
+#include <vector>
+
+#include <SFML/System.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "broadphase.h"
+
+namespace ag {
+
+// Sweep and prune along the x axis. The endpoint list is kept sorted between
+// frames and repaired with an insertion sort, which is close to linear when
+// objects only move a little each frame. Objects are tracked by id; any id
+// that is not inserted during a frame is dropped when the frame is built.
+class SweepAndPrune : public Broadphase {
+ public:
+  SweepAndPrune();
+  ~SweepAndPrune() {};
+
+  void clear() override;
+  void insert(unsigned int index, unsigned int id,
+              sf::FloatRect bounds, Filter filter) override;
+  void build() override;
+  void retrieve(unsigned int index, sf::FloatRect bounds, Filter filter,
+                std::vector<Candidate> &candidates) const override;
+  void retrieve_area(sf::FloatRect bounds, Filter filter,
+                     std::vector<Candidate> &candidates) const override;
+  unsigned int get_pair_count() const;
+
+ private:
+  struct Proxy {
+    unsigned int index;
+    sf::FloatRect bounds;
+    Filter filter;
+    unsigned int frame;
+    unsigned int active_slot;
+    bool listed;
+  };
+
+  struct Endpoint {
+    float value;
+    unsigned int id;
+    bool minimum;
+  };
+
+  bool endpoint_less(const Endpoint &left, const Endpoint &right) const;
+  void update_endpoints();
+  void sort_endpoints();
+  void sweep();
+  void add_pair(unsigned int first, unsigned int second);
+
+  std::vector<Proxy> m_proxies;
+  std::vector<Endpoint> m_endpoints;
+  std::vector<unsigned int> m_active;
+  std::vector<unsigned int> m_pairs;
+  std::vector<unsigned int> m_partner_start;
+  std::vector<unsigned int> m_partner_end;
+  std::vector<unsigned int> m_partners;
+  unsigned int m_object_count;
+  unsigned int m_pair_count;
+  unsigned int m_frame;
+};
+
+}
+
+#endif
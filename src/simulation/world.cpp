@@ -0,0 +1,84 @@
+#include "world.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System.hpp>
+
+#include "entity_store.h"
+#include "game_object.h"
+#include "random.h"
+
+namespace ag {
+
+sf::Vector2f World::get_size() const {
+  return WORLD_SIZE;
+}
+
+sf::Vector2f World::get_center() const {
+  return WORLD_SIZE / 2.0F;
+}
+
+sf::Vector2f World::saucer_spawn_position(Random &random) const {
+  unsigned int position_index = random.next_below(SAUCER_SPAWNS.size());
+  return SAUCER_SPAWNS.at(position_index);
+}
+
+bool World::outside(sf::Vector2f position) const {
+  return position.x < 0.0F || position.y < 0.0F ||
+         position.x >= WORLD_SIZE.x || position.y >= WORLD_SIZE.y;
+}
+
+void World::wrap_object(EntityStore &objects, unsigned int index) const {
+  sf::Vector2f position = objects.positions[index];
+  if (position.x < 0.0F) {
+    position.x += WORLD_SIZE.x;
+  } else if (position.x >= WORLD_SIZE.x) {
+    position.x -= WORLD_SIZE.x;
+  }
+  if (position.y < 0.0F) {
+    position.y += WORLD_SIZE.y;
+  } else if (position.y >= WORLD_SIZE.y) {
+    position.y -= WORLD_SIZE.y;
+  }
+  objects.move_to(index, position);
+}
+
+bool World::off_camera(sf::Vector2f position, float radius) const {
+  return position.x < -radius ||
+         position.y < -radius ||
+         position.x > WORLD_SIZE.x + radius ||
+         position.y > WORLD_SIZE.y + radius;
+}
+
+sf::Vector2f World::valid_asteroid_position(const EntityStore &objects,
+                                            Random &random) const {
+  float old_x, old_y, new_x, new_y, distance;
+  bool invalid;
+  do {
+    invalid = false;
+    new_x = random.next_below(static_cast<std::uint32_t>(WORLD_SIZE.x));
+    new_y = random.next_below(static_cast<std::uint32_t>(WORLD_SIZE.y));
+    if (new_x <= 50.0F || new_x >= WORLD_SIZE.x - 50.0F ||
+        new_y <= 50.0F || new_y >= WORLD_SIZE.y - 50.0F) {
+      invalid = true;
+    }
+    for (std::size_t i = 0U; i < objects.size(); i++) {
+      old_x = objects.positions[i].x;
+      old_y = objects.positions[i].y;
+      distance = sqrt(pow((old_x - new_x), 2) + pow((old_y - new_y), 2));
+      if (objects.types[i] == GameObject::PlayerType &&
+          distance < WORLD_SIZE.y / 6.0F) {
+          invalid = true;
+      } else if (objects.types[i] == GameObject::AsteroidType &&
+                 distance < 110.0F) {
+          invalid = true;
+      }
+    }
+  } while (invalid);
+  return sf::Vector2f{new_x, new_y};
+}
+
+}
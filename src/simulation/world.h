@@ -0,0 +1,51 @@
+#ifndef ASTEROIDS_GAME_CODE_INCLUDE_WORLD_H
+#define ASTEROIDS_GAME_CODE_INCLUDE_WORLD_H
+
+#include <algorithm>
+#include <vector>
+
+#include <SFML/System.hpp>
+
+#include "entity_store.h"
+#include "random.h"
+
+namespace ag {
+
+// The playfield the simulation runs in: its size, where objects wrap around
+// its edges and where new asteroids and saucers may appear. Random choices
+// draw from the caller's stream so that they replay with its seed.
+class World {
+ public:
+  World() {};
+  ~World() {};
+
+  sf::Vector2f get_size() const;
+  sf::Vector2f get_center() const;
+  sf::Vector2f saucer_spawn_position(Random &random) const;
+  // The world is a torus exactly its size across: an object whose position
+  // leaves it comes back by one whole width or height, and one partly over
+  // an edge is drawn, and collides, on both sides.
+  bool outside(sf::Vector2f position) const;
+  void wrap_object(EntityStore &objects, unsigned int index) const;
+  // Whether an object is wholly past an edge.
+  bool off_camera(sf::Vector2f position, float radius) const;
+  sf::Vector2f valid_asteroid_position(const EntityStore &objects,
+                                       Random &random) const;
+
+ private:
+  const sf::Vector2f WORLD_SIZE{1280.0F, 720.0F};
+  const std::vector<sf::Vector2f> SAUCER_SPAWNS{
+    sf::Vector2f{
+      -10.0F,
+      std::min(WORLD_SIZE.y - WORLD_SIZE.y / 10.0F, WORLD_SIZE.y - 10.0F)
+    },
+    sf::Vector2f{
+      WORLD_SIZE.x + 10.0F,
+      std::max(WORLD_SIZE.y / 10.0F, 40.0F)
+    }
+  };
+};
+
+}
+
+#endif